@@ -0,0 +1,172 @@
+/*
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2021, 2022 Chris M. (RealTimeChris)
+
+	This library is free software; you can redistribute it and/or
+	modify it under the terms of the GNU Lesser General Public
+	License as published by the Free Software Foundation; either
+	version 2.1 of the License, or (at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+	Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public
+	License along with this library; if not, write to the Free Software
+	Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+	USA
+*/
+/// AudioCache.hpp - Header for the on-disk cache of encoded songs.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file AudioCache.hpp
+
+#pragma once
+
+#include <discordcoreapi/FoundationEntities.hpp>
+#include <discordcoreapi/AudioEncoder.hpp>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <stop_token>
+
+namespace DiscordCoreInternal {
+
+	class DiscordCoreAPI_Dll AudioCache;
+
+	/// \brief The state of a single cached song, shared between its writer and any number of readers.
+	struct DiscordCoreAPI_Dll AudioCacheEntry {
+		std::condition_variable_any growthCondition{};///< Signalled whenever the writer publishes more frames, completes, or fails.
+		std::filesystem::path path{};///< The file that holds the song's frames.
+		std::mutex accessMutex{};///< Guards size, isItComplete and haveWeFailed.
+		std::string songKey{};///< The song's source and id, which its file name is a hash of.
+		uint64_t readerCount{};///< How many readers currently have the entry open - guarded by the cache's mutex.
+		uint64_t lastAccess{};///< When the entry was last opened, on the cache's own clock - guarded by the cache's mutex.
+		uint64_t size{};///< How many bytes of the file hold complete records, which readers may read.
+		bool isItComplete{};///< Has the whole song been written?
+		bool haveWeFailed{};///< Was the write abandoned?
+	};
+
+	/// \brief Fills one AudioCacheEntry with a song's frames, as it is being downloaded and decoded.
+	class DiscordCoreAPI_Dll AudioCacheWriter {
+	  public:
+		static constexpr uint64_t framesPerPublish{ 50 };///< How many frames to write before making them visible to readers - one second.
+		static constexpr uint64_t pcmFrameSize{ 960 * 2 * 2 };///< The size of a 20ms frame of 48kHz stereo PCM.
+
+		AudioCacheWriter(AudioCache* cacheNew, uint64_t keyNew, std::shared_ptr<AudioCacheEntry> entryNew, std::ofstream&& fileNew);
+
+		/// \brief Adds a frame to the entry, encoding it first if it holds PCM.
+		/// \param frame The frame, as it was sent to the SongAPI.
+		void writeFrame(const DiscordCoreAPI::AudioFrameData& frame);
+
+		/// \brief Marks the song as complete, making it available to future plays.
+		void complete();
+
+		/// \brief Abandons the entry, and removes its file, unless complete() has been called.
+		~AudioCacheWriter() noexcept;
+
+	  protected:
+		std::unique_ptr<OpusEncoderWrapper> encoder{ nullptr };
+		std::basic_string<std::byte> pendingSamples{};
+		std::shared_ptr<AudioCacheEntry> entry{};
+		uint64_t framesSincePublish{};
+		AudioCache* cache{ nullptr };
+		std::ofstream file{};
+		uint64_t size{};
+		uint64_t key{};
+		bool isItDone{};
+
+		void encodeAndWrite(std::basic_string_view<std::byte> samples);
+
+		void writeRecord(std::basic_string_view<std::byte> record);
+
+		void publish();
+
+		void abort() noexcept;
+	};
+
+	/// \brief Replays the frames of one AudioCacheEntry, following its writer if it is still being filled.
+	class DiscordCoreAPI_Dll AudioCacheReader {
+	  public:
+		AudioCacheReader(AudioCache* cacheNew, uint64_t keyNew, std::shared_ptr<AudioCacheEntry> entryNew, std::ifstream&& fileNew,
+			uint64_t offsetNew);
+
+		/// \brief Collects the next frame, waiting for the writer if it has yet to publish one.
+		/// \param frame The frame to fill, as an encoded frame.
+		/// \param token A token that ends the wait early.
+		/// \returns False once the song has ended, the writer has failed, or the token has been stopped.
+		bool readFrame(DiscordCoreAPI::AudioFrameData& frame, std::stop_token token);
+
+		/// \brief Checks whether the reader stopped because the entry's writer abandoned it, rather than at the end of the song.
+		/// \returns A bool representing whether the entry has failed.
+		bool haveWeFailed();
+
+		~AudioCacheReader() noexcept;
+
+	  protected:
+		std::shared_ptr<AudioCacheEntry> entry{};
+		AudioCache* cache{ nullptr };
+		std::ifstream file{};
+		uint64_t offset{};
+		uint64_t key{};
+	};
+
+	/// \brief A content-addressed, on-disk cache of songs as 20ms Opus frames, keyed by their source and id, with a size budget that
+	/// is kept by evicting the least-recently played songs.
+	class DiscordCoreAPI_Dll AudioCache {
+	  public:
+		friend class AudioCacheWriter;
+		friend class AudioCacheReader;
+
+		static constexpr uint32_t magic{ 0x43414344 };///< "DCAC", at the start of every file.
+		static constexpr uint8_t version{ 1 };///< The version of the file format.
+
+		/// \brief Opens the cache, and indexes the complete songs that a previous run left in its directory.
+		/// \param directoryNew The directory to hold the cache's files.
+		/// \param maxSizeInBytesNew The most bytes that the complete songs may take up.
+		AudioCache(const std::string& directoryNew, uint64_t maxSizeInBytesNew);
+
+		/// \brief Starts caching a song, unless it is already cached or being cached.
+		/// \param song The song to cache.
+		/// \returns A writer to send the song's frames to, or nullptr.
+		std::unique_ptr<AudioCacheWriter> beginWrite(const DiscordCoreAPI::Song& song);
+
+		/// \brief Opens a song for playback, if it is cached, or is being cached.
+		/// \param song The song to play.
+		/// \returns A reader for the song's frames, or nullptr.
+		std::unique_ptr<AudioCacheReader> openReader(const DiscordCoreAPI::Song& song);
+
+		/// \brief Collects the total size of the complete songs in the cache.
+		/// \returns The size, in bytes.
+		uint64_t getSize();
+
+	  protected:
+		std::unordered_map<uint64_t, std::shared_ptr<AudioCacheEntry>> entries{};
+		std::filesystem::path directory{};
+		uint64_t maxSizeInBytes{};
+		uint64_t accessCounter{};
+		std::mutex accessMutex{};
+		uint64_t totalSize{};
+
+		static std::string getSongKey(const DiscordCoreAPI::Song& song);
+
+		static uint64_t hashSongKey(std::string_view songKey);
+
+		static std::string getFileHeader(std::string_view songKey);
+
+		std::filesystem::path getPath(uint64_t key);
+
+		void loadEntry(const std::filesystem::path& path);
+
+		void completeEntry(uint64_t key, uint64_t size);
+
+		void abortEntry(uint64_t key, const std::shared_ptr<AudioCacheEntry>& entry);
+
+		void releaseReader(uint64_t key, const std::shared_ptr<AudioCacheEntry>& entry);
+
+		void evictEntries();
+	};
+
+}// namespace DiscordCoreInternal
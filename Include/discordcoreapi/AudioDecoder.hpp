@@ -43,13 +43,43 @@ namespace DiscordCoreInternal {
 
 		OpusDecoderWrapper();
 
-		std::basic_string_view<opus_int16> decodeData(std::basic_string_view<std::byte> dataToDecode);
+		/// \brief Decodes a packet of Opus audio.
+		/// \param dataToDecode The packet to decode.
+		/// \param decodeFec Whether to decode the packet's in-band FEC data, which describes the 20ms frame before it, instead.
+		/// \returns The decoded stereo samples.
+		std::basic_string_view<opus_int16> decodeData(std::basic_string_view<std::byte> dataToDecode, bool decodeFec = false);
+
+		/// \brief Synthesizes a lost frame with the decoder's packet-loss concealment.
+		/// \param sampleCount The number of samples per channel to synthesize.
+		/// \returns The synthesized stereo samples.
+		std::basic_string_view<opus_int16> concealLoss(int32_t sampleCount);
+
+		/// \brief Returns the decoder to its freshly-created state, so that it can be handed to a different stream.
+		void resetState() noexcept;
 
 	  protected:
 		std::unique_ptr<OpusDecoder, OpusDecoderDeleter> ptr{ nullptr, OpusDecoderDeleter{} };
 		std::vector<opus_int16> data{};
 	};
 
+	/// \brief A pool of idle Opus decoders, so that users who start and stop speaking don't each cost a decoder's creation.
+	class DiscordCoreAPI_Dll OpusDecoderPool {
+	  public:
+		static constexpr uint64_t maxIdleDecoders{ 32 };
+
+		/// \brief Collects an idle decoder, or creates one if there are none.
+		/// \returns The decoder.
+		std::unique_ptr<OpusDecoderWrapper> acquireDecoder();
+
+		/// \brief Hands a decoder back to the pool, once its stream has gone quiet or left.
+		/// \param decoder The decoder to return.
+		void releaseDecoder(std::unique_ptr<OpusDecoderWrapper> decoder) noexcept;
+
+	  protected:
+		std::vector<std::unique_ptr<OpusDecoderWrapper>> idleDecoders{};
+		std::mutex accessMutex{};
+	};
+
 	struct DiscordCoreAPI_Dll AVFrameWrapper {
 		struct DiscordCoreAPI_Dll AVFrameDeleter {
 			void operator()(AVFrame* other);
@@ -177,6 +207,7 @@ namespace DiscordCoreInternal {
 	struct DiscordCoreAPI_Dll BuildAudioDecoderData {
 	  public:
 		DiscordCoreAPI::ConfigManager* configManager{ nullptr };
+		bool doWePassthroughOpus{ true };
 		int64_t totalFileSize{};
 		int64_t bufferMaxSize{};
 	};
@@ -206,6 +237,8 @@ namespace DiscordCoreInternal {
 		std::atomic_bool haveWeFailedBool{};
 		AVFrameWrapper frame{}, newFrame{};
 		std::atomic_bool areWeQuitting{};
+		bool doWePassthroughOpus{};
+		bool isItPassthrough{};
 		AVIOContextWrapper ioContext{};
 		SwrContextWrapper swrContext{};
 		std::string currentBuffer{};
@@ -217,6 +250,10 @@ namespace DiscordCoreInternal {
 
 		static int32_t ReadBufferData(void* opaque, uint8_t* buf, int32_t);
 
+		/// \brief Hands the current packet on as an AudioFrameType::Encoded frame, without decoding it.
+		/// \returns A bool representing whether or not the packet could be passed through - once one can't, transcoding takes over.
+		bool sendEncodedFrame();
+
 		void run(std::stop_token token);
 
 		void cancelMe();
@@ -42,12 +42,20 @@ namespace DiscordCoreInternal {
 
 		OpusEncoderWrapper();
 
+		/// \brief Applies a new set of encoder settings.
+		/// \param options The settings to apply.
+		void setOptions(const DiscordCoreAPI::OpusEncoderOptions& options);
+
+		/// \brief Encodes a frame of 48kHz stereo PCM into a single Opus packet.
+		/// \param inputFrame The frame to encode.
+		/// \returns The encoded bytes, which are empty if the encoder has decided that no packet needs to be sent (DTX).
 		EncoderReturnData encodeData(std::basic_string_view<std::byte> inputFrame);
 
 	  protected:
 		std::unique_ptr<OpusEncoder, OpusEncoderDeleter> ptr{ nullptr, OpusEncoderDeleter{} };
 		std::basic_string<std::byte> encodedData{};
 		const int32_t maxBufferSize{ 1276 };
+		bool enableDtx{};
 		const int32_t sampleRate{ 48000 };
 		const int32_t nChannels{ 2 };
 	};
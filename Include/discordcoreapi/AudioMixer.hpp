@@ -0,0 +1,99 @@
+/*
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2021, 2022 Chris M. (RealTimeChris)
+
+	This library is free software; you can redistribute it and/or
+	modify it under the terms of the GNU Lesser General Public
+	License as published by the Free Software Foundation; either
+	version 2.1 of the License, or (at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+	Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public
+	License along with this library; if not, write to the Free Software
+	Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+	USA
+*/
+/// AudioMixer.hpp - Header for the audio mixer class.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file AudioMixer.hpp
+
+#pragma once
+
+#include <discordcoreapi/FoundationEntities.hpp>
+#include <opus/opus.h>
+
+namespace DiscordCoreInternal {
+
+	/// \brief The instruction sets that the mixer has kernels for.
+	enum class MixerInstructionSet : uint8_t {
+		Scalar = 0,///< Plain C++.
+		Sse41 = 1,///< SSE4.1.
+		Avx2 = 2,///< AVX2.
+		Avx512 = 3///< AVX-512F.
+	};
+
+	/// \brief Sums any number of speakers' decoded 48kHz stereo PCM, each with its own gain, and passes the result through a
+	/// lookahead soft limiter, rather than dividing it by the number of speakers.
+	class DiscordCoreAPI_Dll AudioMixer {
+	  public:
+		static constexpr uint64_t lookaheadFrames{ 64 };///< The limiter's lookahead, in stereo frames - 1.33ms.
+		static constexpr uint64_t maxSampleCount{ 5760 * 2 };///< The most samples that a single frame can hold - 120ms of stereo.
+		static constexpr float kneeStart{ 24576.0f };///< The level above which the limiter starts to reduce the gain.
+		static constexpr float ceiling{ 32000.0f };///< The level that the limiter's output approaches, but never passes.
+
+		AudioMixer() noexcept;
+
+		/// \brief Starts a new frame, discarding the previous one's sum.
+		void beginFrame() noexcept;
+
+		/// \brief Adds a speaker's samples to the current frame.
+		/// \param samples The speaker's decoded, interleaved stereo samples.
+		/// \param gain The gain to apply to the speaker, where 1.0 leaves them unchanged.
+		void addSpeaker(std::basic_string_view<opus_int16> samples, float gain) noexcept;
+
+		/// \brief Limits and converts the current frame.
+		/// \returns The mixed samples, which are valid until the next call, and lag the input by lookaheadFrames.
+		std::basic_string_view<opus_int16> endFrame() noexcept;
+
+		/// \brief Clears the limiter's lookahead and gain, such as once everyone has stopped speaking.
+		void reset() noexcept;
+
+		/// \brief Collects the widest instruction set that both the CPU and the OS support, detected once, at runtime.
+		/// \returns The instruction set that the mixing kernels are dispatched to.
+		static MixerInstructionSet getInstructionSet() noexcept;
+
+	  protected:
+		using AccumulateFunction = void (*)(float*, const opus_int16*, uint64_t, float) noexcept;
+
+		std::array<float, lookaheadFrames * 2> delaySamples{};
+		std::array<float, lookaheadFrames> delayGains{};
+		std::vector<opus_int16> outputSamples{};
+		AccumulateFunction accumulate{ nullptr };
+		std::vector<float> accumulator{};
+		float releaseCoefficient{};
+		float attackCoefficient{};
+		uint64_t sampleCount{};
+		uint64_t delayIndex{};
+		float windowMin{ 1.0f };
+		float envelope{ 1.0f };
+
+		static MixerInstructionSet detectInstructionSet() noexcept;
+
+		static float getRequiredGain(float peak) noexcept;
+
+		static void accumulateScalar(float* output, const opus_int16* input, uint64_t count, float gain) noexcept;
+
+		static void accumulateSse41(float* output, const opus_int16* input, uint64_t count, float gain) noexcept;
+
+		static void accumulateAvx2(float* output, const opus_int16* input, uint64_t count, float gain) noexcept;
+
+		static void accumulateAvx512(float* output, const opus_int16* input, uint64_t count, float gain) noexcept;
+	};
+
+}// namespace DiscordCoreInternal
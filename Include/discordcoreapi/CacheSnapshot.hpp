@@ -0,0 +1,226 @@
+/*
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2021, 2022 Chris M. (RealTimeChris)
+
+	This library is free software; you can redistribute it and/or
+	modify it under the terms of the GNU Lesser General Public
+	License as published by the Free Software Foundation; either
+	version 2.1 of the License, or (at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+	Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public
+	License along with this library; if not, write to the Free Software
+	Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+	USA
+*/
+/// CacheSnapshot.hpp - Header for the cache snapshot related classes and structs.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file CacheSnapshot.hpp
+
+#pragma once
+
+#include <discordcoreapi/FoundationEntities.hpp>
+#include <discordcoreapi/ChannelEntities.hpp>
+#include <discordcoreapi/GuildEntities.hpp>
+#include <discordcoreapi/GuildMemberEntities.hpp>
+#include <discordcoreapi/RoleEntities.hpp>
+#include <discordcoreapi/UserEntities.hpp>
+
+namespace DiscordCoreAPI {
+
+	/**
+	 * \addtogroup utilities
+	 * @{
+	 */
+
+	/// \brief The kinds of section that a cache snapshot may contain.
+	enum class CacheSnapshotSection : uint32_t {
+		Guilds = 1,///< GuildData entries.
+		Channels = 2,///< ChannelData entries.
+		Roles = 3,///< RoleData entries.
+		Users = 4,///< UserData entries.
+		GuildMembers = 5///< The GuildMembers of one Guild per entry.
+	};
+
+	/// \brief The fixed-size header at the start of a cache snapshot file.
+	struct DiscordCoreAPI_Dll CacheSnapshotHeader {
+		uint64_t magic{};///< Always CacheSnapshots::magic - also rejects files written on a machine of the other byte order.
+		uint32_t version{};///< The version of the snapshot format.
+		uint32_t sectionCount{};///< The number of sections following the header.
+		uint64_t payloadLength{};///< The number of bytes following the header.
+		uint64_t checksum{};///< A hash of the bytes following the header.
+		int64_t createdAtInMs{};///< When the snapshot was written, in milliseconds since the epoch.
+	};
+
+	/// \brief The fixed-size header at the start of each section of a cache snapshot.
+	struct DiscordCoreAPI_Dll CacheSnapshotSectionHeader {
+		CacheSnapshotSection type{};///< The kind of entries in the section.
+		uint32_t reserved{};///< Unused - keeps the header 8-byte aligned.
+		uint64_t entryCount{};///< The number of entries in the section.
+		uint64_t length{};///< The number of bytes following the section header.
+	};
+
+	/// \brief Appends fixed-width values, strings and id lists to a cache snapshot's buffer.
+	class DiscordCoreAPI_Dll CacheSnapshotWriter {
+	  public:
+		template<typename OTy> void writeValue(OTy value) {
+			static_assert(std::is_trivially_copyable_v<OTy>);
+			this->buffer.append(reinterpret_cast<const char*>(&value), sizeof(OTy));
+		}
+
+		void writeString(std::string_view string);
+
+		void writeIds(const std::vector<Snowflake>& ids);
+
+		/// \brief Reserves space for a section's header, to be filled in by endSection().
+		/// \param type The kind of entries in the section.
+		void beginSection(CacheSnapshotSection type);
+
+		/// \brief Fills in the header of the section begun most recently.
+		/// \param entryCount The number of entries that were written to the section.
+		void endSection(uint64_t entryCount);
+
+		std::string& getBuffer() noexcept;
+
+		uint32_t getSectionCount() const noexcept;
+
+	  protected:
+		uint64_t sectionOffset{};
+		uint32_t sectionCount{};
+		std::string buffer{};
+	};
+
+	/// \brief Reads back the values written by a CacheSnapshotWriter, throwing a DCAException rather than reading past the end.
+	class DiscordCoreAPI_Dll CacheSnapshotReader {
+	  public:
+		CacheSnapshotReader(std::string_view dataNew) noexcept;
+
+		template<typename OTy> OTy readValue() {
+			static_assert(std::is_trivially_copyable_v<OTy>);
+			OTy returnValue{};
+			std::memcpy(&returnValue, this->readBytes(sizeof(OTy)), sizeof(OTy));
+			return returnValue;
+		}
+
+		std::string_view readString();
+
+		void readIds(std::vector<Snowflake>& ids);
+
+		const char* readBytes(uint64_t length);
+
+		bool isItDone() const noexcept;
+
+	  protected:
+		std::string_view data{};
+		uint64_t offset{};
+	};
+
+	/// \brief A read-only, memory-mapped view of a file.
+	class DiscordCoreAPI_Dll MemoryMappedFile {
+	  public:
+		MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+		MemoryMappedFile(const MemoryMappedFile&) = delete;
+
+		/// \brief Maps the file, leaving the view empty if it could not be opened.
+		/// \param path The path of the file to map.
+		MemoryMappedFile(const std::string& path) noexcept;
+
+		std::string_view getData() const noexcept;
+
+		~MemoryMappedFile() noexcept;
+
+	  protected:
+		void* mappingHandle{ nullptr };
+		void* fileHandle{ nullptr };
+		const char* data{ nullptr };
+		uint64_t length{};
+	};
+
+	/// \brief Writes the Guild, Channel, Role, User and GuildMember caches to a versioned binary file, and restores them from it through a
+	/// memory mapping, so that a restarted bot can answer from its cache before the gateway has re-sent every Guild.
+	class DiscordCoreAPI_Dll CacheSnapshots {
+	  public:
+		static constexpr uint64_t magic{ 0x50414e5341434400ull };///< "\0DCASNAP", in little-endian order.
+		static constexpr uint32_t version{ 1 };
+
+		/// \brief Writes the current contents of the caches, replacing the file at path only once the new snapshot is complete.
+		/// \param path The path of the snapshot file.
+		/// \returns A bool representing whether or not the snapshot was written.
+		static bool save(const std::string& path);
+
+		/// \brief Validates the snapshot at path and inserts its contents into the caches.
+		/// \param path The path of the snapshot file.
+		/// \returns A bool representing whether or not a valid snapshot was loaded.
+		static bool load(const std::string& path);
+
+		/// \brief Drops the restored Channels, Roles and GuildMembers of a Guild that are missing from its fresh GUILD_CREATE - only done
+		/// once per restored Guild, and for GuildMembers, only when the GUILD_CREATE listed every one of them.
+		/// \param guild The Guild, as just received from the gateway.
+		static void reconcileGuild(const GuildData& guild);
+
+		/// \brief Drops the restored Guilds of a shard that are missing from its READY payload, as the bot left them while offline, along
+		/// with their Channels, Roles and GuildMembers.
+		/// \param shard The shard that received the READY payload.
+		/// \param shardCount The total number of shards.
+		/// \param guildIds The Guilds that the READY payload listed.
+		static void reconcileReady(uint32_t shard, uint32_t shardCount, const std::vector<Snowflake>& guildIds);
+
+		/// \brief Forgets the restored Guilds of a shard, once all of its Guilds have been ingested - and once none remain for any shard,
+		/// drops the restored Users that no cached GuildMember refers to.
+		/// \param shard The shard whose Guilds have been ingested.
+		/// \param shardCount The total number of shards.
+		static void finishReconciling(uint32_t shard, uint32_t shardCount);
+
+	  protected:
+		/// \brief The Channels and Roles that a restored Guild had when the snapshot was written.
+		struct RestoredGuildData {
+			std::vector<Snowflake> channels{};
+			std::vector<Snowflake> roles{};
+		};
+
+		static std::unordered_map<uint64_t, RestoredGuildData> restoredGuilds;
+		static std::unordered_set<uint64_t> restoredUsers;
+		static std::mutex accessMutex;
+		static std::mutex saveMutex;
+
+		static uint64_t computeChecksum(std::string_view data) noexcept;
+
+		static void removeGuild(Snowflake guildId, const RestoredGuildData& guild);
+
+		static void loadSection(CacheSnapshotSection type, uint64_t entryCount, CacheSnapshotReader& reader);
+
+		static void writeIconHash(CacheSnapshotWriter& writer, const IconHash& icon);
+
+		static void writeTimeStamp(CacheSnapshotWriter& writer, const TimeStamp& timeStamp);
+
+		static void writeGuild(CacheSnapshotWriter& writer, const GuildData& guild);
+
+		static GuildData readGuild(CacheSnapshotReader& reader);
+
+		static void writeChannel(CacheSnapshotWriter& writer, const ChannelData& channel);
+
+		static ChannelData readChannel(CacheSnapshotReader& reader);
+
+		static void writeRole(CacheSnapshotWriter& writer, const RoleData& role);
+
+		static RoleData readRole(CacheSnapshotReader& reader);
+
+		static void writeUser(CacheSnapshotWriter& writer, const UserData& user);
+
+		static UserData readUser(CacheSnapshotReader& reader);
+
+		static void writeGuildMembers(CacheSnapshotWriter& writer, const GuildMemberColumns& guildMembers);
+
+		static GuildMemberColumns readGuildMembers(CacheSnapshotReader& reader);
+	};
+
+	/**@}*/
+
+}// namespace DiscordCoreAPI
@@ -34,6 +34,15 @@ namespace DiscordCoreAPI {
 		return lhs.id == rhs.id;
 	}
 
+	DiscordCoreAPI_Dll inline Snowflake getCacheKey(const ChannelData& object) {
+		return object.id;
+	}
+
+	DiscordCoreAPI_Dll inline uint64_t getCacheFootprint(const ChannelData& object) {
+		return sizeof(ChannelData) + object.permissionOverwrites.capacity() * sizeof(OverWriteData) + object.name.getHeapFootprint() +
+			object.topic.getHeapFootprint();
+	}
+
 	/**
 	 * \addtogroup foundation_entities
 	 * @{
@@ -242,6 +251,11 @@ namespace DiscordCoreAPI {
 		/// \returns A CoRoutine containing a Channel.
 		static ChannelData getCachedChannel(GetChannelData dataPackage);
 
+		/// \brief Collects a read-only handle to a Channel in the library's cache, without copying it or collecting it from Discord.
+		/// \param dataPackage A GetChannelData structure.
+		/// \returns A shared_ptr to the cached ChannelData, or nullptr if it is not cached.
+		static std::shared_ptr<const ChannelData> getCachedChannelView(GetChannelData dataPackage);
+
 		/// \brief Modifies a Channel's properties.
 		/// \param dataPackage A ModifyChannelData structure.
 		/// \returns A CoRoutine containing a Channel.
@@ -306,6 +320,8 @@ namespace DiscordCoreAPI {
 		/// \returns A CoRoutine containing a VoiceRegionDataVector.
 		static CoRoutine<std::vector<VoiceRegionData>> getVoiceRegionsAsync();
 
+		static ObjectCache<ChannelData>& getCache();
+
 		static void insertChannel(ChannelData channel);
 
 		static void removeChannel(Snowflake channelId);
@@ -370,5 +370,75 @@ namespace DiscordCoreAPI {
 		std::coroutine_handle<typename CoRoutine<RTy>::promise_type> coroHandle{};
 	};
 
+	/// \brief An asynchronous iterator over a paginated endpoint, which collects the following page in the background while the current one is
+	/// being processed. It must outlive, and not be moved during, any pending call to getNextPageAsync().
+	/// \tparam OTy The type of object contained in each page.
+	/// \tparam DTy The type of data structure used to request each page.
+	template<typename OTy, typename DTy> class PageIterator {
+	  public:
+		using CollectFunction = std::function<std::vector<OTy>(DTy)>;///< Collects a single page.
+		using AdvanceFunction = std::function<bool(DTy&, std::vector<OTy>&)>;///< Moves the request past a page, returns false on the last page.
+		using BudgetFunction = std::function<bool()>;///< Returns whether or not the rate-limit bucket can spare a prefetched request.
+
+		PageIterator(DTy dataPackageNew, CollectFunction collectFunctionNew, AdvanceFunction advanceFunctionNew,
+			BudgetFunction canWePrefetchNew = nullptr) {
+			this->advanceFunction = std::move(advanceFunctionNew);
+			this->collectFunction = std::move(collectFunctionNew);
+			this->canWePrefetch = std::move(canWePrefetchNew);
+			this->dataPackage = std::move(dataPackageNew);
+		}
+
+		PageIterator(PageIterator<OTy, DTy>&& other) noexcept = default;
+
+		/// \brief Collects the next page, and begins collecting the one after it if the rate-limit bucket has requests to spare.
+		/// \returns A CoRoutine containing the next page, which is empty once the endpoint has been exhausted.
+		CoRoutine<std::vector<OTy>> getNextPageAsync() {
+			co_await NewThreadAwaitable<std::vector<OTy>>();
+			std::vector<OTy> currentPage{};
+			if (this->areWeDone) {
+				co_return std::move(currentPage);
+			}
+			if (!this->nextPage) {
+				this->nextPage.reset(new CoRoutine<std::vector<OTy>>{ collectPageAsync(this->collectFunction, this->dataPackage) });
+			}
+			currentPage = this->nextPage->get();
+			this->nextPage.reset();
+			if (currentPage.size() == 0 || !this->advanceFunction(this->dataPackage, currentPage)) {
+				this->areWeDone = true;
+			} else if (!this->canWePrefetch || this->canWePrefetch()) {
+				this->nextPage.reset(new CoRoutine<std::vector<OTy>>{ collectPageAsync(this->collectFunction, this->dataPackage) });
+			}
+			co_return std::move(currentPage);
+		}
+
+		/// \brief Checks whether or not the endpoint has been exhausted.
+		/// \returns A bool representing whether or not there are pages left to collect.
+		bool isItDone() {
+			return this->areWeDone;
+		}
+
+		~PageIterator() {
+			if (this->nextPage) {
+				try {
+					this->nextPage->cancel();
+				} catch (...) {
+				}
+			}
+		}
+
+	  protected:
+		std::unique_ptr<CoRoutine<std::vector<OTy>>> nextPage{};
+		AdvanceFunction advanceFunction{};
+		CollectFunction collectFunction{};
+		BudgetFunction canWePrefetch{};
+		bool areWeDone{};
+		DTy dataPackage{};
+
+		static CoRoutine<std::vector<OTy>> collectPageAsync(CollectFunction collectFunction, DTy dataPackage) {
+			co_await NewThreadAwaitable<std::vector<OTy>>();
+			co_return collectFunction(dataPackage);
+		}
+	};
+
 	/**@}*/
 };// namespace DiscordCoreAPI
@@ -60,6 +60,8 @@ namespace DiscordCoreAPI {
 
 	uint64_t getUint64(simdjson::ondemand::value jsonData, const char* key);
 
+	uint64_t getUint64(simdjson::ondemand::value jsonData);
+
 	uint32_t getUint32(simdjson::ondemand::value jsonData, const char* key);
 
 	uint16_t getUint16(simdjson::ondemand::value jsonData, const char* key);
@@ -70,6 +72,8 @@ namespace DiscordCoreAPI {
 
 	bool getBool(simdjson::ondemand::value jsonData, const char* key);
 
+	bool getBool(simdjson::ondemand::value jsonData);
+
 	std::string getString(simdjson::ondemand::value jsonData, const char* key);
 
 	std::string getString(ObjectReturnData jsonData, const char* key);
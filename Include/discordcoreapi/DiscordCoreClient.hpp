@@ -27,7 +27,9 @@
 
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/ApplicationCommandEntities.hpp>
+#include <discordcoreapi/AudioCache.hpp>
 #include <discordcoreapi/AutoModerationEntities.hpp>
+#include <discordcoreapi/CacheSnapshot.hpp>
 #include <discordcoreapi/ChannelEntities.hpp>
 #include <discordcoreapi/CoRoutine.hpp>
 #include <discordcoreapi/CommandController.hpp>
@@ -102,6 +104,7 @@ namespace DiscordCoreAPI {
 	/// \brief DiscordCoreClient - The main class for this library.
 	class DiscordCoreAPI_Dll DiscordCoreClient {
 	  public:
+		friend class DiscordCoreInternal::GuildIngestionPipeline;
 		friend class DiscordCoreInternal::WebSocketClient;
 		friend class DiscordCoreInternal::BaseSocketAgent;
 		friend class DiscordCoreInternal::WebSocketCore;
@@ -110,6 +113,8 @@ namespace DiscordCoreAPI {
 		friend class BotUser;
 		friend class Guilds;
 
+		static DiscordCoreInternal::AudioCache* getAudioCache(Snowflake guildId);
+
 		static DiscordCoreInternal::SoundCloudAPI* getSoundCloudAPI(Snowflake guildId);
 
 		static DiscordCoreInternal::YouTubeAPI* getYouTubeAPI(Snowflake guildId);
@@ -158,6 +163,9 @@ namespace DiscordCoreAPI {
 	  protected:
 		static BotUser currentUser;
 
+		std::unique_ptr<DiscordCoreInternal::GuildIngestionPipeline> guildIngestionPipeline{ nullptr };
+		std::unique_ptr<DiscordCoreInternal::VoiceEngine> voiceEngine{ nullptr };
+		std::unique_ptr<DiscordCoreInternal::AudioCache> audioCache{ nullptr };
 		std::unordered_map<uint32_t, std::unique_ptr<DiscordCoreInternal::BaseSocketAgent>> baseSocketAgentsMap{};
 		std::unique_ptr<DiscordCoreInternal::HttpsClient> httpsClient{ nullptr };
 		std::deque<CreateApplicationCommandData> commandsToRegister{};
@@ -49,6 +49,12 @@ namespace DiscordCoreAPI {
 		int32_t timeUntilNextPing{};///< The number of milliseconds until the next ping.
 	};
 
+	/// \brief Data that is received once every guild listed in a shard's READY payload has been ingested into the cache.
+	struct DiscordCoreAPI_Dll OnGuildsReadyData {
+		uint64_t guildCount{};///< The number of guilds that were ingested for this shard.
+		uint32_t shardId{};///< The shard whose guilds are now ready.
+	};
+
 	/// \brief Data that is received as part of an InputEvent creation event.
 	struct DiscordCoreAPI_Dll OnInputEventCreationData {
 		InputEventData inputEventData{};///< InputEventData representing the input-event.
@@ -1020,6 +1026,15 @@ namespace DiscordCoreAPI {
 		/// \param token An DiscordCoreInternal::EventDelegateToken, from the original event registration.
 		void onWebhookUpdate(DiscordCoreInternal::EventDelegateToken& token);
 
+		/// \brief For adding a function to handle this event.
+		/// \param handler A delegate taking an OnGuildsReadyData structure as an argument.
+		/// \returns An event_token for later de-registering the event.
+		DiscordCoreInternal::EventDelegateToken onGuildsReady(
+			const DiscordCoreInternal::EventDelegate<CoRoutine<void>, OnGuildsReadyData> handler);
+		/// \brief For removing a function from handling this event.
+		/// \param token An DiscordCoreInternal::EventDelegateToken, from the original event registration.
+		void onGuildsReady(DiscordCoreInternal::EventDelegateToken& token);
+
 		DiscordCoreInternal::Event<CoRoutine<void>, OnGatewayPingData> onGatewayPingEvent{};
 
 		DiscordCoreInternal::Event<CoRoutine<void>, OnApplicationCommandPermissionsUpdateData> onApplicationCommandPermissionsUpdateEvent{};
@@ -1141,6 +1156,8 @@ namespace DiscordCoreAPI {
 		DiscordCoreInternal::Event<CoRoutine<void>, OnVoiceServerUpdateData> onVoiceServerUpdateEvent{};
 
 		DiscordCoreInternal::Event<CoRoutine<void>, OnWebhookUpdateData> onWebhookUpdateEvent{};
+
+		DiscordCoreInternal::Event<CoRoutine<void>, OnGuildsReadyData> onGuildsReadyEvent{};
 	};
 	/**@}*/
 
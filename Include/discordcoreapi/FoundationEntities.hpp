@@ -264,14 +264,109 @@ namespace DiscordCoreInternal {
 		LAST = 170
 	};
 
+	/// \brief A source of Https request-body data, which is streamed to the socket piece by piece instead of being collected up-front.
+	class DiscordCoreAPI_Dll HttpsBodySource {
+	  public:
+		/// \brief Collects the next piece of the body.
+		/// \returns The next piece of the body, or an empty view once the source has been exhausted.
+		virtual std::string_view readData() = 0;
+
+		/// \brief Rewinds the source back to its beginning, so that the request can be re-sent.
+		virtual void rewind() = 0;
+
+		/// \brief Returns the total number of bytes that this source will produce.
+		virtual uint64_t size() = 0;
+
+		virtual ~HttpsBodySource() noexcept = default;
+	};
+
+	/// \brief A body source for a block of in-memory data. Rvalue strings are owned, while views must outlive the request.
+	class DiscordCoreAPI_Dll HttpsStringBodySource : public HttpsBodySource {
+	  public:
+		HttpsStringBodySource(std::string&& dataNew);
+
+		HttpsStringBodySource(std::string_view dataNew);
+
+		std::string_view readData();
+
+		void rewind();
+
+		uint64_t size();
+
+	  protected:
+		std::string_view dataView{};
+		std::string data{};
+		bool haveWeRead{};
+	};
+
+	/// \brief A body source that reads from an open file descriptor, from its current position. The descriptor is not closed by the source.
+	class DiscordCoreAPI_Dll HttpsFileBodySource : public HttpsBodySource {
+	  public:
+		HttpsFileBodySource(int32_t fileDescriptorNew, uint64_t sizeNew);
+
+		std::string_view readData();
+
+		void rewind();
+
+		uint64_t size();
+
+	  protected:
+		std::string buffer{};
+		int32_t fileDescriptor{};
+		uint64_t bytesRemaining{};
+		int64_t startOffset{};
+		uint64_t totalSize{};
+	};
+
+	/// \brief A body source that maps a file into memory, so that its contents are written to the socket without being copied.
+	class DiscordCoreAPI_Dll HttpsMappedFileBodySource : public HttpsBodySource {
+	  public:
+		HttpsMappedFileBodySource(const std::string& filePath);
+
+		std::string_view readData();
+
+		void rewind();
+
+		uint64_t size();
+
+		~HttpsMappedFileBodySource() noexcept;
+
+	  protected:
+		std::string_view mappedData{};
+		uint64_t currentOffset{};
+#ifdef _WIN32
+		HANDLE mappingHandle{ nullptr };
+		HANDLE fileHandle{ INVALID_HANDLE_VALUE };
+#endif
+	};
+
+	/// \brief A body source that collects its data from a callback, which is passed the offset of the next piece to produce.
+	class DiscordCoreAPI_Dll HttpsGeneratorBodySource : public HttpsBodySource {
+	  public:
+		HttpsGeneratorBodySource(std::function<std::string_view(uint64_t)> generatorNew, uint64_t sizeNew);
+
+		std::string_view readData();
+
+		void rewind();
+
+		uint64_t size();
+
+	  protected:
+		std::function<std::string_view(uint64_t)> generator{};
+		uint64_t currentOffset{};
+		uint64_t totalSize{};
+	};
+
 	class DiscordCoreAPI_Dll HttpsWorkloadData {
 	  public:
+		friend class HttpsRequestGuard;
 		friend class HttpsClient;
 
 		static std::unordered_map<HttpsWorkloadType, std::unique_ptr<std::atomic_int64_t>> workloadIdsExternal;
 		static std::unordered_map<HttpsWorkloadType, std::unique_ptr<std::atomic_int64_t>> workloadIdsInternal;
 
 		mutable std::unordered_map<std::string, std::string> headersToInsert{};
+		std::vector<std::unique_ptr<HttpsBodySource>> bodySources{};///< Streamed in place of content, when present.
 		PayloadType payloadType{ PayloadType::Application_Json };
 		mutable std::atomic_int64_t thisWorkerId{};
 		HttpsWorkloadClass workloadClass{};
@@ -292,9 +387,21 @@ namespace DiscordCoreInternal {
 
 		HttpsWorkloadData(HttpsWorkloadType type) noexcept;
 
+		/// \brief Sets up the body of this workload as streamed multipart-form data, referencing the files' data rather than copying it.
+		/// \param payloadJson The json payload of the request.
+		/// \param files The files to attach, which must outlive the request.
+		void setMultiPartContent(std::string payloadJson, const std::vector<DiscordCoreAPI::File>& files);
+
+		uint64_t getBodySize() const;
+
+		/// \brief Collects a printable form of the request's body, for error messages.
+		/// \returns The json content, or an outline of the multipart-form parts, which are never printed in full.
+		std::string getContentSummary() const;
+
 	  protected:
 		static int64_t incrementAndGetWorkloadId(HttpsWorkloadType workloadType) noexcept;
 
+		std::string multiPartSummary{};
 		HttpsWorkloadType workloadType{};
 	};
 
@@ -672,6 +779,7 @@ namespace DiscordCoreAPI {
 	struct DiscordCoreAPI_Dll File {
 		std::string fileName{};///< The name of the file.
 		std::string data{};///< The data of the file.
+		std::string filePath{};///< A path to stream the file's data from, in place of data.
 	};
 
 	/// \brief The sorting order, for Guild Forum channels.
@@ -1810,7 +1918,7 @@ namespace DiscordCoreAPI {
 		DiscordCoreClient* discordCoreClient{ nullptr };///< A pointer to the DiscordCoreClient.
 		VoiceConnection* voiceConnectionPtr{ nullptr };///< A pointer to the VoiceConnection, if present.
 		std::vector<Snowflake> guildScheduledEvents{};///< Array of Guild channels.
-		std::vector<PresenceUpdateData> presences{};///< Presence states for each of the GuildMembers..
+		std::vector<PresenceUpdateData> presences{};///< Presence states for each of the GuildMembers, as of the GUILD_CREATE.
 		std::vector<Snowflake> stageInstances{};///< Array of Guild channels.
 		std::vector<Snowflake> stickers{};///< Array of Guild channels.
 		std::vector<Snowflake> channels{};///< Array of Guild channels.
@@ -1843,9 +1951,10 @@ namespace DiscordCoreAPI {
 		/// \param selfDeaf Whether or not to self-deafen the bot.
 		/// \param selfMute Whether or not to self-mute the bot.
 		/// \param streamInfo For usage with the Vc-to-Vc audio streaming option.
+		/// \param encoderOptions The settings for the outgoing audio's encoder.
 		/// \returns VoiceConnection* A pointer to the currently held voice connection, or nullptr if it failed to connect.
 		VoiceConnection* connectToVoice(const Snowflake guildMemberId, const Snowflake channelId = Snowflake{}, bool selfDeaf = false,
-			bool selfMute = false, StreamInfo streamInfo = StreamInfo{});
+			bool selfMute = false, StreamInfo streamInfo = StreamInfo{}, OpusEncoderOptions encoderOptions = OpusEncoderOptions{});
 
 		template<IsEnum ETy> bool getFlagValue(ETy theEnum) {
 			return getBool(this->flags, theEnum);
@@ -3419,6 +3528,7 @@ namespace DiscordCoreInternal {
 
 	struct DiscordCoreAPI_Dll ReadyData {
 		DiscordCoreAPI::ApplicationData application{};
+		std::vector<DiscordCoreAPI::Snowflake> guilds{};
 		DiscordCoreAPI::UserData user{};
 		std::string resumeGatewayUrl{};
 		std::string sessionId{};
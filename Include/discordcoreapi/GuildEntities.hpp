@@ -39,6 +39,19 @@ namespace DiscordCoreAPI {
 		return lhs.id == rhs.id;
 	}
 
+	DiscordCoreAPI_Dll inline Snowflake getCacheKey(const GuildData& object) {
+		return object.id;
+	}
+
+	DiscordCoreAPI_Dll inline uint64_t getCacheFootprint(const GuildData& object) {
+		return sizeof(GuildData) + object.presences.capacity() * sizeof(PresenceUpdateData) +
+			(object.guildScheduledEvents.capacity() + object.stageInstances.capacity() + object.stickers.capacity() +
+				object.channels.capacity() + object.threads.capacity() + object.members.capacity() + object.roles.capacity() +
+				object.emoji.capacity()) *
+			sizeof(Snowflake) +
+			object.name.getHeapFootprint();
+	}
+
 	/**
 	 * \addtogroup foundation_entities
 	 * @{
@@ -421,6 +434,11 @@ namespace DiscordCoreAPI {
 		/// \returns A CoRoutine containing a Guild.
 		static GuildData getCachedGuild(GetGuildData dataPackage);
 
+		/// \brief Collects a read-only handle to a Guild in the library's cache, without copying it or collecting it from Discord.
+		/// \param dataPackage A GetGuildData structure.
+		/// \returns A shared_ptr to the cached GuildData, or nullptr if it is not cached.
+		static std::shared_ptr<const GuildData> getCachedGuildView(GetGuildData dataPackage);
+
 		/// \brief Acquires the preview Data of a chosen Guild.
 		/// \param dataPackage A GetGuildPreviewData structure.
 		/// \returns A CoRoutine containing a GuildPreviewData.
@@ -441,6 +459,11 @@ namespace DiscordCoreAPI {
 		/// \returns A CoRoutine containing a BanDataVector.
 		static CoRoutine<std::vector<BanData>> getGuildBansAsync(GetGuildBansData dataPackage);
 
+		/// \brief Creates an iterator over every Ban of a chosen Guild, one page at a time.
+		/// \param dataPackage A GetGuildBansData structure, whose limit is used as the page size.
+		/// \returns A PageIterator of BanData.
+		static PageIterator<BanData, GetGuildBansData> iterateGuildBans(GetGuildBansData dataPackage);
+
 		/// \brief Collects a single Ban from a chosen Guild.
 		/// \param dataPackage A GetGuildBanData structure.
 		/// \returns A CoRoutine containing a BanData.
@@ -578,7 +601,9 @@ namespace DiscordCoreAPI {
 
 		static ObjectCache<GuildData>& getCache();
 
-		static void insertGuild(GuildData guild);
+		static void insertGuild(const GuildData& guild);
+
+		static void insertGuild(GuildData&& guild);
 
 		static void removeGuild(const Snowflake GuildId);
 
@@ -39,6 +39,118 @@ namespace DiscordCoreAPI {
 		return (lhs.guildId == rhs.guildId) && (lhs.id == rhs.id);
 	}
 
+	DiscordCoreAPI_Dll inline GuildScopedKey getCacheKey(const VoiceStateDataLight& object) {
+		return GuildScopedKey{ object.guildId, object.userId };
+	}
+
+	DiscordCoreAPI_Dll inline GuildScopedKey getCacheKey(const GuildMemberData& object) {
+		return GuildScopedKey{ object.guildId, object.id };
+	}
+
+	DiscordCoreAPI_Dll inline uint64_t getCacheFootprint(const GuildMemberData& object) {
+		return sizeof(GuildMemberData) + object.roles.capacity() * sizeof(Snowflake) + object.nick.getHeapFootprint();
+	}
+
+	/// \brief The cached GuildMembers of a single Guild, stored column-by-column rather than as one GuildMemberData each.
+	/// Each distinct list of Roles is stored once and shared by every member holding it, and nicks are packed into a single arena. The
+	/// GuildMember cache's policy, CacheOptions::guildMemberTablePolicy, counts, sizes and expires these tables, not single members.
+	class DiscordCoreAPI_Dll GuildMemberColumns {
+	  public:
+		Snowflake guildId{};///< The id of the Guild that these GuildMembers belong to.
+
+		GuildMemberColumns() noexcept = default;
+
+		GuildMemberColumns(Snowflake guildIdNew) noexcept;
+
+		/// \brief Inserts a GuildMember, replacing any GuildMember that already exists with the same id.
+		/// \param guildMember The GuildMember to be inserted.
+		void insert(GuildMemberData& guildMember);
+
+		/// \brief Removes a GuildMember.
+		/// \param guildMemberId The id of the GuildMember to remove.
+		/// \returns A bool representing whether or not the GuildMember was present.
+		bool erase(Snowflake guildMemberId);
+
+		/// \brief Rebuilds a GuildMember from its columns.
+		/// \param guildMemberId The id of the GuildMember to collect.
+		/// \param guildMember The GuildMemberData to fill in.
+		/// \returns A bool representing whether or not the GuildMember was present.
+		bool getGuildMember(Snowflake guildMemberId, GuildMemberData& guildMember) const;
+
+		/// \brief Checks whether or not a GuildMember is present.
+		/// \param guildMemberId The id of the GuildMember to check for.
+		/// \returns A bool representing whether or not the GuildMember is present.
+		bool contains(Snowflake guildMemberId) const noexcept;
+
+		/// \brief Rebuilds every GuildMember from its columns, one at a time.
+		/// \param function A function that takes a const GuildMemberData&.
+		template<typename FTy> void forEach(FTy&& function) const {
+			GuildMemberData guildMember{};
+			for (auto& value: this->ids) {
+				this->getGuildMember(value, guildMember);
+				function(static_cast<const GuildMemberData&>(guildMember));
+			}
+		}
+
+		/// \brief Visits the id of every GuildMember, without rebuilding them.
+		/// \param function A function that takes a Snowflake.
+		template<typename FTy> void forEachId(FTy&& function) const {
+			for (auto& value: this->ids) {
+				function(value);
+			}
+		}
+
+		/// \brief Collects the approximate number of bytes held by these columns, including their tables.
+		/// \returns The approximate number of bytes.
+		uint64_t getMemoryFootprint() const noexcept;
+
+		uint64_t size() const noexcept;
+
+	  protected:
+		static constexpr uint32_t npos{ std::numeric_limits<uint32_t>::max() };
+
+		std::unordered_multimap<uint64_t, uint32_t> roleSetIndices{};///< Role list hashes, mapped to their indices in roleSets.
+		std::vector<std::vector<Snowflake>> roleSets{};///< Each distinct, sorted list of Roles.
+		std::vector<uint32_t> roleSetRefCounts{};///< The number of members holding each list of Roles.
+		std::vector<uint32_t> freeRoleSets{};///< The indices of unused lists of Roles.
+		std::vector<uint32_t> rowIndices{};///< An open-addressed table of row index + 1, keyed by member id.
+		std::vector<uint32_t> roleSetIds{};///< Each member's index in roleSets.
+		std::vector<uint32_t> nickOffsets{};///< Each member's nick offset in nickArena.
+		std::vector<uint16_t> nickLengths{};///< Each member's nick length.
+		std::vector<GuildMemberFlags> flags{};///< Each member's flags.
+		std::vector<Permissions> permissions{};///< Each member's Permissions.
+		std::vector<TimeStamp> joinedAts{};///< Each member's join time.
+		std::vector<IconHash> avatars{};///< Each member's avatar.
+		std::vector<Snowflake> ids{};///< Each member's id.
+		uint64_t nickGarbageLength{};///< The number of bytes in nickArena no longer used by any member.
+		uint64_t roleSetLength{};///< The total number of Roles across roleSets.
+		std::string nickArena{};///< Every member's nick, back-to-back.
+
+		uint32_t findRow(Snowflake guildMemberId) const noexcept;
+
+		uint32_t internRoleSet(std::vector<Snowflake>& roles);
+
+		void releaseRoleSet(uint32_t roleSetId);
+
+		void setNick(uint32_t row, std::string_view nick);
+
+		void compactNicks();
+
+		void placeRow(Snowflake guildMemberId, uint32_t row) noexcept;
+
+		void eraseRowIndex(Snowflake guildMemberId) noexcept;
+
+		void growRowIndices();
+	};
+
+	DiscordCoreAPI_Dll inline Snowflake getCacheKey(const GuildMemberColumns& object) {
+		return object.guildId;
+	}
+
+	DiscordCoreAPI_Dll inline uint64_t getCacheFootprint(const GuildMemberColumns& object) {
+		return object.getMemoryFootprint();
+	}
+
 	/**
 	 * \addtogroup foundation_entities
 	 * @{
@@ -181,11 +293,23 @@ namespace DiscordCoreAPI {
 		/// \returns A CoRoutine containing a GuildMember.
 		static GuildMemberData getCachedGuildMember(GetGuildMemberData dataPackage);
 
+		/// \brief Collects a read-only handle to a GuildMember in the library's cache, without collecting it from Discord. Unlike the
+		/// other entities' views, this is not zero-copy: GuildMembers are cached as GuildMemberColumns tables rather than as whole objects,
+		/// so each call allocates a new GuildMemberData and rebuilds the GuildMember into it, just as getCachedGuildMember() does.
+		/// \param dataPackage A GetGuildMemberData structure.
+		/// \returns A shared_ptr to a freshly-built copy of the cached GuildMemberData, or nullptr if it is not cached.
+		static std::shared_ptr<const GuildMemberData> getCachedGuildMemberView(GetGuildMemberData dataPackage);
+
 		/// \brief Lists all of the GuildMembers of a chosen Guild.
 		/// \param dataPackage A ListGuildMembersData structure.
 		/// \returns A CoRoutine containing a vector<GuildMembers>.
 		static CoRoutine<std::vector<GuildMember>> listGuildMembersAsync(ListGuildMembersData dataPackage);
 
+		/// \brief Creates an iterator over all of the GuildMembers of a chosen Guild, one page at a time.
+		/// \param dataPackage A ListGuildMembersData structure, whose limit is used as the page size.
+		/// \returns A PageIterator of GuildMembers.
+		static PageIterator<GuildMember, ListGuildMembersData> iterateGuildMembers(ListGuildMembersData dataPackage);
+
 		/// \brief Searches for a list of GuildMembers of a chosen Guild.
 		/// \param dataPackage A SearchGuildMembersData structure.
 		/// \returns A CoRoutine containing a vector<GuildMembers>.
@@ -218,7 +342,7 @@ namespace DiscordCoreAPI {
 
 		static ObjectCache<VoiceStateDataLight>& getVsCache();
 
-		static ObjectCache<GuildMemberData>& getCache();
+		static ObjectCache<GuildMemberColumns>& getCache();
 
 		static void insertVoiceState(VoiceStateData voiceState);
 
@@ -233,7 +357,7 @@ namespace DiscordCoreAPI {
 	  protected:
 		static DiscordCoreInternal::HttpsClient* httpsClient;
 		static ObjectCache<VoiceStateDataLight> vsCache;
-		static ObjectCache<GuildMemberData> cache;
+		static ObjectCache<GuildMemberColumns> cache;
 		static bool doWeCacheGuildMembersBool;
 	};
 	/**@}*/
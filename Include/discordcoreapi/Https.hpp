@@ -27,13 +27,23 @@
 
 #include <discordcoreapi/SSLClients.hpp>
 #include <semaphore>
+#include <optional>
+#include <charconv>
+#include <future>
 
 namespace DiscordCoreInternal {
 
 	class DiscordCoreAPI_Dll HttpsConnectionManager;
 	struct DiscordCoreAPI_Dll RateLimitData;
 
-	enum class HttpsState { Collecting_Code = 0, Collecting_Headers = 1, Collecting_Size = 2, Collecting_Contents = 3 };
+	enum class HttpsState {
+		Collecting_Code = 0,
+		Collecting_Headers = 1,
+		Collecting_Size = 2,
+		Collecting_Contents = 3,
+		Collecting_Trailers = 4,
+		Complete = 5
+	};
 
 	class DiscordCoreAPI_Dll HttpsError : public DiscordCoreAPI::DCAException {
 	  public:
@@ -56,6 +66,12 @@ namespace DiscordCoreInternal {
 		bool isItChunked{};
 	};
 
+	/// \brief The location of a single response header's key and value, within the connection's header buffer.
+	struct DiscordCoreAPI_Dll HttpsHeaderSpan {
+		LengthData value{};///< The offset and length of the header's value.
+		LengthData key{};///< The offset and length of the header's key.
+	};
+
 	class DiscordCoreAPI_Dll HttpsRnRBuilder {
 	  public:
 		friend class HttpsClient;
@@ -68,27 +84,39 @@ namespace DiscordCoreInternal {
 
 		std::string buildRequest(const HttpsWorkloadData& workload);
 
-		uint64_t parseHeaders(StringBuffer& other);
-
-		bool parseChunk(StringBuffer& other);
+		/// \brief Advances the response parser over a newly-received block of data, in a single pass.
+		/// \param other The newly-received data.
+		/// \returns A bool representing whether or not the response has been fully collected.
+		bool parseData(std::string_view other);
 
 		virtual ~HttpsRnRBuilder() noexcept = default;
 
 	  protected:
+		std::vector<HttpsHeaderSpan> headerSpans{};
+		uint64_t remainingChunkSize{};
 		bool doWePrintErrorMessages{};
 		bool doWeHaveContentSize{};
-		bool doWeHaveHeaders{};
+		uint64_t lineOffset{};
 		bool isItChunked{};
 
-		uint64_t parseSize(StringBuffer& other);
+		bool collectLine(std::string_view& other, std::string_view& line);
+
+		uint64_t parseContents(std::string_view other);
+
+		void parseHeader(std::string_view line);
 
-		uint64_t parseCode(StringBuffer& other);
+		void parseSize(std::string_view line);
 
-		void clearCRLF(StringBuffer& other);
+		void parseCode(std::string_view line);
+
+		void finalizeHeaders();
+
+		void clearLine();
 	};
 
 	struct DiscordCoreAPI_Dll RateLimitData {
 		friend class HttpsConnectionManager;
+		friend class HttpsRequestGuard;
 		friend class HttpsRnRBuilder;
 		friend class HttpsClient;
 
@@ -121,6 +149,13 @@ namespace DiscordCoreInternal {
 
 		void handleBuffer() noexcept;
 
+		/// \brief Writes a request whose body is streamed from the workload's body sources, waiting on the socket whenever it is full.
+		/// \param request The request line and headers.
+		/// \param workload The workload whose body sources are to be written.
+		/// \param msToWait The maximum time to wait for the socket to become writable, between pieces.
+		/// \returns A ProcessIOResult representing whether or not the whole request was written.
+		ProcessIOResult writeStreamingRequest(std::string_view request, const HttpsWorkloadData& workload, int32_t msToWait);
+
 		void disconnect() noexcept;
 
 		void resetValues();
@@ -149,11 +184,43 @@ namespace DiscordCoreInternal {
 		int64_t currentIndex{};
 	};
 
+	/// \brief A successful Https GET response, held for reuse by identical requests.
+	struct DiscordCoreAPI_Dll HttpsCachedResponse {
+		Milliseconds storedTime{};///< When the response was stored.
+		HttpsResponseData data{};///< The response itself.
+	};
+
+	class DiscordCoreAPI_Dll HttpsClient;
+
+	/// \brief Settles the request that HttpsClient::httpsRequest() is executing, on every path out of it - publishing its response to
+	/// any identical GETs waiting on it, or failing them if it threw, and handing the rate-limit bucket on to the next request.
+	class DiscordCoreAPI_Dll HttpsRequestGuard {
+	  public:
+		HttpsRequestGuard(HttpsClient* clientNew, RateLimitData* rateLimitDataNew, const HttpsWorkloadData* workloadNew,
+			const std::string* requestKeyNew, std::promise<HttpsResponseData>* promiseNew) noexcept;
+
+		/// \brief Removes the request's in-flight entry, caches its response if it may be reused, and hands it to the waiting GETs.
+		/// \param resultData The response.
+		void publish(HttpsResponseData& resultData);
+
+		~HttpsRequestGuard() noexcept;
+
+	  protected:
+		std::promise<HttpsResponseData>* promise{ nullptr };
+		const HttpsWorkloadData* workload{ nullptr };
+		const std::string* requestKey{ nullptr };
+		RateLimitData* rateLimitData{ nullptr };
+		HttpsClient* client{ nullptr };
+		bool isItPublished{};
+	};
+
 	template<typename OTy>
 	concept SameAsVoid = std::same_as<void, OTy>;
 
 	class DiscordCoreAPI_Dll HttpsClient {
 	  public:
+		friend class HttpsRequestGuard;
+
 		HttpsClient(DiscordCoreAPI::ConfigManager* configManager);
 
 		template<typename RTy> RTy submitWorkloadAndGetResult(const HttpsWorkloadData& workload, RTy* returnValue) {
@@ -169,8 +236,8 @@ namespace DiscordCoreInternal {
 
 			if (static_cast<uint32_t>(returnData.responseCode) != 200 && static_cast<uint32_t>(returnData.responseCode) != 204 &&
 				static_cast<uint32_t>(returnData.responseCode) != 201) {
-				HttpsError theError{ DiscordCoreAPI::shiftToBrightRed() + workload.callStack +
-					" Https Error: " + static_cast<std::string>(returnData.responseCode) + "\nThe Request: " + workload.content +
+				HttpsError theError{ DiscordCoreAPI::shiftToBrightRed() + workload.callStack + " Https Error: " +
+					static_cast<std::string>(returnData.responseCode) + "\nThe Request: " + workload.getContentSummary() +
 					DiscordCoreAPI::reset() + "" };
 				theError.errorCode = returnData.responseCode;
 				httpsConnection->areWeCheckedOut.store(false);
@@ -207,9 +274,19 @@ namespace DiscordCoreInternal {
 
 		HttpsResponseData httpsRequest(HttpsConnection* httpsConnection, const HttpsWorkloadData& workload);
 
+		/// \brief Collects the number of requests left in the current rate-limit bucket of a given type of workload.
+		/// \param workloadType The type of workload to check the bucket of.
+		/// \returns The number of requests remaining, as last reported by Discord.
+		int64_t getRemainingRequests(HttpsWorkloadType workloadType);
+
 	  protected:
+		std::unordered_map<std::string, std::shared_future<HttpsResponseData>> inFlightRequests{};
+		std::unordered_map<std::string, HttpsCachedResponse> cachedResponses{};
 		DiscordCoreAPI::ConfigManager* configManager{ nullptr };
 		HttpsConnectionManager connectionManager{ nullptr };
+		std::mutex inFlightMutex{};
+
+		void waitForWorkloadTurn(const HttpsWorkloadData& workload);
 
 		HttpsResponseData httpsRequestInternal(HttpsConnection* connection, const HttpsWorkloadData& workload,
 			RateLimitData& rateLimitData);
@@ -230,6 +230,11 @@ namespace DiscordCoreAPI {
 		/// \returns A CoRoutine containing a MessageVector.
 		static CoRoutine<std::vector<Message>> getMessagesAsync(GetMessagesData dataPackage);
 
+		/// \brief Creates an iterator over every Message that matches a GetMessagesData structure, one page at a time.
+		/// \param dataPackage A GetMessagesData structure, whose limit is used as the page size.
+		/// \returns A PageIterator of Messages.
+		static PageIterator<Message, GetMessagesData> iterateMessages(GetMessagesData dataPackage);
+
 		/// \brief Collects a Message from the Discord servers.
 		/// \param dataPackage A GetMessageData structure.
 		/// \returns A CoRoutine containing a Message.
@@ -260,6 +265,11 @@ namespace DiscordCoreAPI {
 		/// \returns A CoRoutine containing void.
 		static CoRoutine<void> deleteMessagesBulkAsync(DeleteMessagesBulkData dataPackage);
 
+		/// \brief Deletes any number of Messages, in batches of up to 100, falling back to single deletions for Messages older than 14 days.
+		/// \param dataPackage A DeleteMessagesBulkData structure.
+		/// \returns A CoRoutine containing void.
+		static CoRoutine<void> deleteMessagesInBatchesAsync(DeleteMessagesBulkData dataPackage);
+
 		/// \brief Collects a collection of pinned Messages from the Discord servers.
 		/// \param dataPackage A GetPinnedMessagesData structure.
 		/// \returns A CoRoutine containing a MessageVector.
@@ -189,6 +189,11 @@ namespace DiscordCoreAPI {
 		/// \returns A CoRoutine containing a UserVector.
 		static CoRoutine<UserVector> getReactionsAsync(GetReactionsData dataPackage);
 
+		/// \brief Creates an iterator over every User that reacted with a given emoji, one page at a time.
+		/// \param dataPackage A GetReactionsData structure, whose limit is used as the page size.
+		/// \returns A PageIterator of Users.
+		static PageIterator<User, GetReactionsData> iterateReactions(GetReactionsData dataPackage);
+
 		/// \brief Deletes all of the Reactions from a given Message.
 		/// \param dataPackage A DeleteAllReactionsData structure.
 		/// \returns A CoRoutine containing void.
@@ -35,6 +35,14 @@ namespace DiscordCoreAPI {
 		return lhs.id == rhs.id;
 	}
 
+	DiscordCoreAPI_Dll inline Snowflake getCacheKey(const RoleData& object) {
+		return object.id;
+	}
+
+	DiscordCoreAPI_Dll inline uint64_t getCacheFootprint(const RoleData& object) {
+		return sizeof(RoleData) + object.name.getHeapFootprint() + object.unicodeEmoji.getHeapFootprint();
+	}
+
 	/**
 	 * \addtogroup foundation_entities
 	 * @{
@@ -235,6 +243,13 @@ namespace DiscordCoreAPI {
 		/// \returns A CoRoutine containing a Role.
 		static RoleData getCachedRole(GetRoleData dataPackage);
 
+		/// \brief Collects a read-only handle to a Role in the library's cache, without copying it or collecting it from Discord.
+		/// \param dataPackage A GetRoleData structure.
+		/// \returns A shared_ptr to the cached RoleData, or nullptr if it is not cached.
+		static std::shared_ptr<const RoleData> getCachedRoleView(GetRoleData dataPackage);
+
+		static ObjectCache<RoleData>& getCache();
+
 		static void insertRole(RoleData role);
 
 		static void removeRole(const Snowflake roleId);
@@ -160,8 +160,8 @@ namespace DiscordCoreInternal {
 
 	class DiscordCoreAPI_Dll SSLConnectionInterface {
 	  public:
-		virtual bool connect(const std::string& baseUrl, const uint16_t portNew, bool doWePrintErrorMessages,
-			bool areWeAStandaloneSocket) noexcept = 0;
+		virtual bool connect(const std::string& baseUrl, const uint16_t portNew, bool doWePrintErrorMessages, bool areWeAStandaloneSocket,
+			int32_t connectTimeoutInMs = 5000) noexcept = 0;
 
 		virtual bool areWeStillConnected() noexcept = 0;
 
@@ -202,12 +202,15 @@ namespace DiscordCoreInternal {
 	  public:
 		virtual void handleBuffer() noexcept = 0;
 
-		bool connect(const std::string& baseUrl, const uint16_t portNew, bool doWePrintErrorMessages, bool areWeAStandaloneSocket) noexcept;
+		bool connect(const std::string& baseUrl, const uint16_t portNew, bool doWePrintErrorMessages, bool areWeAStandaloneSocket,
+			int32_t connectTimeoutInMs = 5000) noexcept;
 
 		static std::vector<TCPSSLClient*> processIO(std::unordered_map<uint32_t, std::unique_ptr<WebSocketClient>>& shardMap) noexcept;
 
 		ProcessIOResult writeData(std::string_view dataToWrite, bool priority) noexcept;
 
+		ProcessIOResult writeDataBlocking(std::string_view dataToWrite, int32_t msToWait) noexcept;
+
 		ProcessIOResult processIO(int32_t msToWait) noexcept;
 
 		std::string_view getInputBuffer() noexcept;
@@ -256,7 +259,11 @@ namespace DiscordCoreInternal {
 		~UDPConnection() noexcept;
 
 	  protected:
+		/// \brief The most datagrams that are sent or received in a single batch - one per slice of the ring-buffers.
+		static constexpr uint64_t maxBatchSize{ 16 };
+
 		const uint64_t maxBufferSize{ (1024 * 16) };
+		bool isItGsoCapable{ true };
 		RingBuffer<std::byte, 16> outputBuffer{};
 		RingBuffer<std::byte, 16> inputBuffer{};
 		DiscordCoreAPI::StreamType streamType{};
@@ -266,5 +273,15 @@ namespace DiscordCoreInternal {
 		std::string baseUrl{};
 		int64_t bytesRead{};
 		uint16_t port{};
+
+		/// \brief Sends every queued datagram, with as few syscalls as possible (sendmmsg, or a single GSO send, where available).
+		/// \returns A bool representing whether or not the socket is still usable.
+		bool processWriteDataBatched() noexcept;
+
+		/// \brief Receives every waiting datagram straight into the input ring-buffer, with as few syscalls as possible (recvmmsg).
+		/// \returns A bool representing whether or not the socket is still usable.
+		bool processReadDataBatched() noexcept;
+
+		bool sendSegmented(std::basic_string_view<std::byte>* packets, uint64_t packetCount) noexcept;
 	};
 }
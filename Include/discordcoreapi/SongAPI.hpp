@@ -26,6 +26,7 @@
 #pragma once
 
 #include <discordcoreapi/FoundationEntities.hpp>
+#include <discordcoreapi/AudioCache.hpp>
 #include <discordcoreapi/EventEntities.hpp>
 #include <discordcoreapi/GuildMemberEntities.hpp>
 #include <discordcoreapi/VoiceConnection.hpp>
@@ -155,6 +156,8 @@ namespace DiscordCoreAPI {
 
 		void sendNextSongFinal(const GuildMember& guildMember);
 
+		void streamFromCache(DiscordCoreInternal::AudioCacheReader& cacheReader, Song song, std::stop_token eventToken);
+
 		void cancelCurrentSong();
 
 		bool sendNextSong();
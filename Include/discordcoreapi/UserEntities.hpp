@@ -34,6 +34,14 @@ namespace DiscordCoreAPI {
 		return lhs.id == rhs.id;
 	}
 
+	DiscordCoreAPI_Dll inline Snowflake getCacheKey(const UserData& object) {
+		return object.id;
+	}
+
+	DiscordCoreAPI_Dll inline uint64_t getCacheFootprint(const UserData& object) {
+		return sizeof(UserData) + object.userName.getHeapFootprint() + object.discriminator.getHeapFootprint();
+	}
+
 	/**
 	 * \addtogroup foundation_entities
 	 * @{
@@ -188,6 +196,11 @@ namespace DiscordCoreAPI {
 		/// \returns A CoRoutine containing a User.
 		static UserData getCachedUser(GetUserData dataPackage);
 
+		/// \brief Collects a read-only handle to a User in the library's cache, without copying it or collecting it from Discord.
+		/// \param dataPackage A GetUserData structure.
+		/// \returns A shared_ptr to the cached UserData, or nullptr if it is not cached.
+		static std::shared_ptr<const UserData> getCachedUserView(GetUserData dataPackage);
+
 		/// \brief Collects a given User from the Discord servers.
 		/// \param dataPackage A GetUserData structure.
 		/// \returns A CoRoutine containing a User.
@@ -210,6 +223,8 @@ namespace DiscordCoreAPI {
 		/// \returns A CoRoutine containing an AuthorizationInfoData.
 		static CoRoutine<AuthorizationInfoData> getCurrentUserAuthorizationInfoAsync();
 
+		static ObjectCache<UserData>& getCache();
+
 		static void insertUser(UserData user);
 
 		static bool doWeCacheUsers();
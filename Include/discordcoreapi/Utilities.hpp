@@ -44,13 +44,18 @@
 		#define WINRT_LEAN_AND_MEAN
 	#endif
 	#include <WinSock2.h>
+	#include <io.h>
 #elif __linux__
 	#ifndef DiscordCoreAPI_Dll
 		#define DiscordCoreAPI_Dll
 	#endif
 	#include <arpa/inet.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
 	#include <sys/time.h>
 	#include <pthread.h>
+	#include <unistd.h>
+	#include <fcntl.h>
 	#include <cstdint>
 	#include <cstring>
 	#include <time.h>
@@ -63,9 +68,11 @@
 #include <shared_mutex>
 #include <immintrin.h>
 #include <functional>
+#include <bit>
 #include <concepts>
 #include <iostream>
 #include <sstream>
+#include <memory>
 #include <iomanip>
 #include <vector>
 #include <atomic>
@@ -163,27 +170,7 @@ namespace DiscordCoreAPI {
 
 	template<typename RTy> void reverseByteOrder(RTy& net) {
 		if constexpr (std::endian::native == std::endian::little) {
-			switch (sizeof(RTy)) {
-				case 1: {
-					return;
-				}
-				case 2: {
-					net = _mm256_extract_epi16(
-						_mm256_shuffle_epi8(_mm256_insert_epi16(__m256i{}, net, 0), _mm256_insert_epi16(__m256i{}, 0x01, 0)), 0);
-					return;
-				}
-				case 4: {
-					net = _mm256_extract_epi32(
-						_mm256_shuffle_epi8(_mm256_insert_epi32(__m256i{}, net, 0), _mm256_insert_epi32(__m256i{}, 0x10203, 0)), 0);
-					return;
-				}
-				case 8: {
-					net = _mm256_extract_epi64(
-						_mm256_shuffle_epi8(_mm256_insert_epi64(__m256i{}, net, 0), _mm256_insert_epi64(__m256i{}, 0x102030405060708, 0)),
-						0);
-					return;
-				}
-			}
+			net = std::byteswap(net);
 		}
 	}
 
@@ -664,6 +651,7 @@ namespace DiscordCoreInternal {
 	using Milliseconds = std::chrono::milliseconds;
 	using Microseconds = std::chrono::microseconds;
 	using Nanoseconds = std::chrono::nanoseconds;
+	using SteadyClock = std::chrono::steady_clock;
 	using SysClock = std::chrono::system_clock;
 	using Seconds = std::chrono::seconds;
 	using namespace std::literals;
@@ -876,6 +864,7 @@ namespace DiscordCoreAPI {
 	using Milliseconds = std::chrono::milliseconds;
 	using Microseconds = std::chrono::microseconds;
 	using Nanoseconds = std::chrono::nanoseconds;
+	using SteadyClock = std::chrono::steady_clock;
 	using SysClock = std::chrono::system_clock;
 	using Seconds = std::chrono::seconds;
 	using namespace std::literals;
@@ -888,6 +877,7 @@ namespace DiscordCoreAPI {
 
 	class DiscordCoreAPI_Dll DiscordCoreClient;
 	class DiscordCoreAPI_Dll VoiceConnection;
+	class DiscordCoreAPI_Dll GuildMemberData;
 	class DiscordCoreAPI_Dll GuildMember;
 	class DiscordCoreAPI_Dll ChannelData;
 	class DiscordCoreAPI_Dll Reactions;
@@ -899,6 +889,8 @@ namespace DiscordCoreAPI {
 
 	template<typename RTy> class CoRoutine;
 
+	template<typename OTy, typename DTy> class PageIterator;
+
 	/// \brief Update-presence status types.
 	enum class UpdatePresenceStatusTypes {
 		online = 0,///< Online.
@@ -996,12 +988,50 @@ namespace DiscordCoreAPI {
 		bool logHttpsErrorMessages{};///< Do we log Https response error messages to cout?
 	};
 
+	/// \brief Eviction algorithms for the library's entity caches.
+	enum class CacheEvictionType : uint8_t {
+		Lru = 0,///< Evict the least-recently-used of a small sample of entities (approximate LRU).
+		Clock = 1///< Evict using the CLOCK algorithm, which gives each recently-used entity a second chance.
+	};
+
+	/// \brief Limits on the size and lifetime of one of the library's entity caches, where 0 disables a limit.
+	struct DiscordCoreAPI_Dll CachePolicy {
+		CacheEvictionType evictionType{ CacheEvictionType::Lru };///< How to choose which entity to evict, once a limit is reached.
+		uint64_t maxEntries{};///< The maximum number of entities to hold.
+		uint64_t maxBytes{};///< The maximum approximate number of bytes to hold.
+		uint32_t ttlInMs{};///< How long an entity is kept after it was last stored or modified, in milliseconds.
+	};
+
 	/// \brief For selecting the caching style of the library.
 	struct DiscordCoreAPI_Dll CacheOptions {
+		CachePolicy guildMemberTablePolicy{};///< Limits for the GuildMember cache, applied to each Guild's table of members as a whole.
+		CachePolicy channelPolicy{};///< Limits for the Channel cache.
+		CachePolicy guildPolicy{};///< Limits for the Guild cache.
+		CachePolicy rolePolicy{};///< Limits for the Role cache.
+		CachePolicy userPolicy{};///< Limits for the User cache.
 		bool cacheChannels{ true };///< Do we cache Channels?
 		bool cacheGuilds{ true };///< Do we cache Guilds?
 		bool cacheRoles{ true };///< Do we cache Roles?
 		bool cacheUsers{ true };///< Do we cache Users/GuildMembers?
+		uint32_t httpsResponseTtlInMs{};///< How long to reuse successful Https GET responses for, in milliseconds (0 to disable).
+		bool internStrings{};///< Do we share one copy of each repeated name and nick across the caches?
+		uint32_t guildIngestionThreadCount{};///< Threads that run Guild events and their handlers, concurrently across Guilds (0 for none).
+		std::string snapshotPath{};///< Where to restore the caches from at startup, and snapshot them to (empty to disable).
+		uint32_t snapshotIntervalInMs{};///< How often to snapshot the caches, in milliseconds (0 to only do so on shutdown).
+	};
+
+	/// \brief Timeout options for the library's Https requests.
+	struct DiscordCoreAPI_Dll HttpsTimeoutOptions {
+		int32_t firstByteTimeoutInMs{ 10000 };///< How long to wait for the first byte of a response, after sending the request.
+		int32_t connectTimeoutInMs{ 5000 };///< How long to wait for the TCP and TLS connection to be established.
+		int32_t idleTimeoutInMs{ 5000 };///< How long a partially-collected response may go without receiving any more data.
+	};
+
+	/// \brief Options for the voice connections of the library.
+	struct DiscordCoreAPI_Dll VoiceOptions {
+		uint32_t threadCount{};///< How many threads to service every voice connection on (0 for one per four hardware threads).
+		std::string audioCachePath{};///< The directory to cache played songs in, as encoded frames (empty to disable).
+		uint64_t audioCacheSizeInBytes{ 1024ull * 1024ull * 1024ull };///< The most disk space that the cached songs may take up.
 	};
 
 	/// \brief Configuration data for the library's main class, DiscordCoreClient.
@@ -1012,8 +1042,10 @@ namespace DiscordCoreAPI {
 		UpdatePresenceData presenceData{};///< Presence data to initialize your bot with.
 		std::string connectionAddress{};///< A potentially alternative connection address for the websocket.
 		ShardingOptions shardOptions{};///< Options for the sharding of your bot.
+		HttpsTimeoutOptions httpsTimeouts{};///< Timeouts for the Https requests of the library.
 		LoggingOptions logOptions{};///< Options for the output/logging of the library.
 		CacheOptions cacheOptions{};///< Options for the cache of the library.
+		VoiceOptions voiceOptions{};///< Options for the voice connections of the library.
 		uint16_t connectionPort{};///< A potentially alternative connection port for the websocket.
 		std::string botToken{};///< Your bot's token.
 	};
@@ -1053,6 +1085,14 @@ namespace DiscordCoreAPI {
 
 		const bool doWeCacheRoles() const;
 
+		const HttpsTimeoutOptions getHttpsTimeoutOptions() const;
+
+		const uint32_t getHttpsResponseTtlInMs() const;
+
+		const CacheOptions getCacheOptions() const;
+
+		const VoiceOptions getVoiceOptions() const;
+
 		const UpdatePresenceData getPresenceData() const;
 
 		const std::string getBotToken() const;
@@ -1135,89 +1175,575 @@ namespace DiscordCoreAPI {
 			ScarletRed = "FF2400";///< Scarlet red.
 	};
 
+	/// \brief A key for objects that are only unique within a single Guild, such as GuildMembers and voice states.
+	struct DiscordCoreAPI_Dll GuildScopedKey {
+		Snowflake guildId{};///< The id of the Guild that the object belongs to.
+		Snowflake id{};///< The id of the object within that Guild.
+
+		bool operator==(const GuildScopedKey&) const noexcept = default;
+	};
+
+	/// \brief Mixes the bits of a 64-bit value, so that sequential snowflakes spread evenly across shards and slots.
+	/// \param value The value to be mixed.
+	/// \returns The mixed value.
+	inline uint64_t mixCacheHash(uint64_t value) noexcept {
+		value ^= value >> 33;
+		value *= 0xff51afd7ed558ccdull;
+		value ^= value >> 33;
+		value *= 0xc4ceb9fe1a85ec53ull;
+		value ^= value >> 33;
+		return value;
+	}
+
+	inline uint64_t getCacheHash(const Snowflake& key) noexcept {
+		return mixCacheHash(static_cast<uint64_t>(key));
+	}
+
+	inline uint64_t getCacheHash(const GuildScopedKey& key) noexcept {
+		return mixCacheHash(static_cast<uint64_t>(key.guildId) ^ mixCacheHash(static_cast<uint64_t>(key.id)));
+	}
+
+	/// \brief Approximates the number of bytes held by an object in an ObjectCache, for types without an overload of their own.
+	/// \param object The object to measure.
+	/// \returns The approximate number of bytes.
+	template<typename OTy> inline uint64_t getCacheFootprint(const OTy& object) noexcept {
+		return sizeof(OTy);
+	}
+
+	/// \brief A concurrent, lock-striped cache of objects, keyed by the value returned by getCacheKey() for the object type.
+	/// Objects are held in reference-counted handles, so a handle returned from find() remains valid after the object is replaced, erased or
+	/// evicted, and an object is only modified in-place when no handles to it are outstanding. Size and lifetime limits are set with setPolicy(),
+	/// and are enforced against the whole cache's totals, on insertion, by evicting from the shard being written (or, failing that, from
+	/// any other shard whose lock is free), though never the object just written.
+	/// \tparam OTy The type of object to be stored.
 	template<typename OTy> class ObjectCache {
 	  public:
+		using KeyType = decltype(getCacheKey(std::declval<const OTy&>()));///< The type of key that identifies each object.
+		using HandleType = std::shared_ptr<const OTy>;///< A read-only, reference-counted handle to a cached object.
+
+		static constexpr uint64_t shardCount{ 64 };
+
 		ObjectCache() noexcept {};
 
-		void emplace(OTy&& data) noexcept {
-			std::unique_lock lock{ this->accessMutex };
-			this->set.emplace(std::move(data));
+		/// \brief Sets the limits on the size and lifetime of the cache, evicting objects as needed to meet them.
+		/// \param policyNew The new limits.
+		void setPolicy(const CachePolicy& policyNew) {
+			int64_t currentTime = ObjectCache::getCurrentTime();
+			for (auto& shard: this->shards) {
+				std::unique_lock lock{ shard.accessMutex };
+				shard.policy = policyNew;
+			}
+			bool wasAnyEvicted{ true };
+			while (wasAnyEvicted && this->isItOverBudget(policyNew)) {
+				wasAnyEvicted = false;
+				for (auto& shard: this->shards) {
+					std::unique_lock lock{ shard.accessMutex };
+					if (this->isItOverBudget(policyNew) && this->evictOne(shard, currentTime, nullptr)) {
+						wasAnyEvicted = true;
+					}
+				}
+			}
 		}
 
-		void emplace(OTy& data) noexcept {
-			std::unique_lock lock{ this->accessMutex };
-			this->set.emplace(data);
+		/// \brief Inserts an object, replacing any object that already exists with the same key.
+		/// \param data The object to be inserted.
+		void emplace(OTy&& data) {
+			this->insertValue(std::make_shared<ObjectCacheEntry>(std::move(data)));
 		}
 
-		const OTy& readOnly(OTy& key) noexcept {
-			std::shared_lock lock{ this->accessMutex };
-			return *this->set.find(key);
+		/// \brief Inserts an object, replacing any object that already exists with the same key.
+		/// \param data The object to be inserted.
+		void emplace(const OTy& data) {
+			this->insertValue(std::make_shared<ObjectCacheEntry>(data));
 		}
 
-		OTy& at(OTy&& key) noexcept {
-			std::shared_lock lock{ this->accessMutex };
-			return ( OTy& )*this->set.find(key);
+		/// \brief Collects a handle to an object.
+		/// \param key The key of the object to collect.
+		/// \returns A handle to the object, or nullptr if it is not present.
+		HandleType find(const KeyType& key) {
+			uint64_t hash = getCacheHash(key);
+			auto& shard = this->getShard(hash);
+			std::shared_lock lock{ shard.accessMutex };
+			uint64_t index = this->findIndex(shard, key, hash);
+			if (index == npos || !this->touchEntry(shard, *shard.slots[index].entry)) {
+				return nullptr;
+			}
+			auto& entry = shard.slots[index].entry;
+			return HandleType{ entry, &entry->value };
 		}
 
-		OTy& at(OTy& key) noexcept {
-			std::shared_lock lock{ this->accessMutex };
-			return ( OTy& )*this->set.find(key);
+		/// \brief Reads an object in-place, under its shard's shared lock, without copying it or its handle.
+		/// \param key The key of the object to read.
+		/// \param function A function that takes a const OTy&.
+		/// \returns A bool representing whether or not the object was present.
+		template<typename FTy> bool visit(const KeyType& key, FTy&& function) {
+			uint64_t hash = getCacheHash(key);
+			auto& shard = this->getShard(hash);
+			std::shared_lock lock{ shard.accessMutex };
+			uint64_t index = this->findIndex(shard, key, hash);
+			if (index == npos || !this->touchEntry(shard, *shard.slots[index].entry)) {
+				return false;
+			}
+			function(static_cast<const OTy&>(shard.slots[index].entry->value));
+			return true;
 		}
 
-		auto begin() {
-			std::unique_lock lock{ this->accessMutex };
-			return this->set.begin();
+		/// \brief Checks whether or not an object is present.
+		/// \param key The key of the object to check for.
+		/// \returns A bool representing whether or not the object is present.
+		bool contains(const KeyType& key) {
+			uint64_t hash = getCacheHash(key);
+			auto& shard = this->getShard(hash);
+			std::shared_lock lock{ shard.accessMutex };
+			uint64_t index = this->findIndex(shard, key, hash);
+			return index != npos && !this->isItExpired(shard, *shard.slots[index].entry, ObjectCache::getCurrentTime());
 		}
 
-		auto end() {
-			std::unique_lock lock{ this->accessMutex };
-			return this->set.end();
+		/// \brief Modifies an object under its shard's lock, copying it first if any handles to it are outstanding.
+		/// \param key The key of the object to modify.
+		/// \param function A function that takes an OTy& and modifies it.
+		/// \returns A bool representing whether or not the object was present.
+		template<typename FTy> bool modify(const KeyType& key, FTy&& function) {
+			uint64_t hash = getCacheHash(key);
+			auto& shard = this->getShard(hash);
+			std::unique_lock lock{ shard.accessMutex };
+			uint64_t index = this->findIndex(shard, key, hash);
+			if (index == npos || !this->touchEntry(shard, *shard.slots[index].entry)) {
+				return false;
+			}
+			auto& entry = shard.slots[index].entry;
+			if (entry.use_count() > 1) {
+				auto entryNew = std::make_shared<ObjectCacheEntry>(entry->value);
+				entryNew->lastAccessTime.store(entry->lastAccessTime.load(std::memory_order_relaxed), std::memory_order_relaxed);
+				entryNew->storedTime = entry->storedTime;
+				entryNew->footprint = entry->footprint;
+				entry = std::move(entryNew);
+			}
+			function(entry->value);
+			this->removeFootprint(shard, entry->footprint);
+			entry->footprint = ObjectCache::getEntryFootprint(entry->value);
+			this->addFootprint(shard, entry->footprint);
+			this->evictWhileOverBudget(shard, ObjectCache::getCurrentTime(), entry.get());
+			return true;
+		}
+
+		/// \brief Modifies an object under its shard's lock, first inserting the given object if none is present with the same key.
+		/// \param data The object to be inserted, if none is present.
+		/// \param function A function that takes an OTy& and modifies it.
+		template<typename FTy> void emplaceOrModify(OTy&& data, FTy&& function) {
+			KeyType key = getCacheKey(static_cast<const OTy&>(data));
+			int64_t currentTime = ObjectCache::getCurrentTime();
+			uint64_t hash = getCacheHash(key);
+			auto& shard = this->getShard(hash);
+			std::unique_lock lock{ shard.accessMutex };
+			uint64_t index = this->findIndex(shard, key, hash);
+			if (index != npos && this->isItExpired(shard, *shard.slots[index].entry, currentTime)) {
+				this->eraseIndex(shard, index);
+				index = npos;
+			}
+			const ObjectCacheEntry* writtenEntry{};
+			if (index == npos) {
+				auto entry = std::make_shared<ObjectCacheEntry>(std::move(data));
+				function(entry->value);
+				entry->footprint = ObjectCache::getEntryFootprint(entry->value);
+				entry->lastAccessTime.store(currentTime, std::memory_order_relaxed);
+				entry->storedTime = currentTime;
+				if ((shard.count + 1) * 4 > shard.slots.size() * 3) {
+					this->growShard(shard);
+				}
+				writtenEntry = entry.get();
+				this->addFootprint(shard, entry->footprint);
+				this->placeSlot(shard, ObjectCacheSlot{ std::move(entry), key }, hash);
+				++shard.count;
+				this->count.fetch_add(1, std::memory_order_relaxed);
+			} else {
+				auto& entry = shard.slots[index].entry;
+				this->touchEntry(shard, *entry);
+				if (entry.use_count() > 1) {
+					auto entryNew = std::make_shared<ObjectCacheEntry>(entry->value);
+					entryNew->lastAccessTime.store(entry->lastAccessTime.load(std::memory_order_relaxed), std::memory_order_relaxed);
+					entryNew->storedTime = entry->storedTime;
+					entryNew->footprint = entry->footprint;
+					entry = std::move(entryNew);
+				}
+				function(entry->value);
+				this->removeFootprint(shard, entry->footprint);
+				entry->footprint = ObjectCache::getEntryFootprint(entry->value);
+				this->addFootprint(shard, entry->footprint);
+				writtenEntry = entry.get();
+			}
+			this->evictWhileOverBudget(shard, currentTime, writtenEntry);
 		}
 
-		const bool contains(OTy& key) noexcept {
-			std::shared_lock lock{ this->accessMutex };
-			return this->set.contains(key);
+		/// \brief Visits every object, one shard at a time, under that shard's shared lock.
+		/// \param function A function that takes a const OTy&.
+		template<typename FTy> void forEach(FTy&& function) {
+			int64_t currentTime = ObjectCache::getCurrentTime();
+			for (auto& shard: this->shards) {
+				std::shared_lock lock{ shard.accessMutex };
+				for (auto& value: shard.slots) {
+					if (value.entry && !this->isItExpired(shard, *value.entry, currentTime)) {
+						function(static_cast<const OTy&>(value.entry->value));
+					}
+				}
+			}
 		}
 
-		void erase(OTy& key) {
-			if (this->set.contains(key)) {
-				std::unique_lock lock{ this->accessMutex };
-				this->set.erase(key);
+		/// \brief Removes an object.
+		/// \param key The key of the object to remove.
+		/// \returns A bool representing whether or not the object was present.
+		bool erase(const KeyType& key) {
+			uint64_t hash = getCacheHash(key);
+			auto& shard = this->getShard(hash);
+			std::unique_lock lock{ shard.accessMutex };
+			uint64_t index = this->findIndex(shard, key, hash);
+			if (index == npos) {
+				return false;
 			}
+			this->eraseIndex(shard, index);
+			return true;
 		}
 
-		OTy& operator[](OTy& key) {
-			if (!this->contains(key)) {
-				std::shared_lock lock{ this->accessMutex };
-				this->set.emplace(key);
+		/// \brief Removes every object whose time-to-live has elapsed.
+		/// \returns The number of objects that were removed.
+		uint64_t evictExpired() {
+			int64_t currentTime = ObjectCache::getCurrentTime();
+			uint64_t returnValue{};
+			for (auto& shard: this->shards) {
+				std::unique_lock lock{ shard.accessMutex };
+				if (shard.policy.ttlInMs == 0) {
+					continue;
+				}
+				for (uint64_t x = 0; x < shard.slots.size();) {
+					if (shard.slots[x].entry && this->isItExpired(shard, *shard.slots[x].entry, currentTime)) {
+						this->eraseIndex(shard, x);
+						++returnValue;
+					} else {
+						++x;
+					}
+				}
 			}
-			return ( OTy& )*this->set.find(key);
+			return returnValue;
 		}
 
-		OTy& operator[](OTy&& key) {
-			if (!this->contains(key)) {
-				std::shared_lock lock{ this->accessMutex };
-				this->set.emplace(std::move(key));
+		/// \brief Collects the approximate number of bytes held by the cache, including its tables.
+		/// \returns The approximate number of bytes.
+		uint64_t getMemoryFootprint() {
+			uint64_t returnValue{ sizeof(ObjectCache<OTy>) };
+			for (auto& shard: this->shards) {
+				std::shared_lock lock{ shard.accessMutex };
+				returnValue += shard.byteCount + shard.slots.size() * sizeof(ObjectCacheSlot);
 			}
-			return ( OTy& )*this->set.find(key);
+			return returnValue;
 		}
 
 		uint64_t size() noexcept {
-			std::unique_lock lock{ this->accessMutex };
-			return this->set.size();
+			return this->count.load(std::memory_order_relaxed);
+		}
+
+	  protected:
+		struct ObjectCacheEntry {
+			std::atomic_int64_t lastAccessTime{};
+			std::atomic_bool wasItAccessed{ true };
+			int64_t storedTime{};
+			uint64_t footprint{};
+			OTy value{};
+
+			ObjectCacheEntry(OTy&& valueNew) : value{ std::move(valueNew) } {};
+
+			ObjectCacheEntry(const OTy& valueNew) : value{ valueNew } {};
+		};
+
+		struct ObjectCacheSlot {
+			std::shared_ptr<ObjectCacheEntry> entry{};
+			KeyType key{};
+		};
+
+		struct alignas(64) ObjectCacheShard {
+			std::vector<ObjectCacheSlot> slots{};
+			std::shared_mutex accessMutex{};
+			uint64_t byteCount{};
+			uint64_t clockHand{};
+			CachePolicy policy{};
+			uint64_t count{};
+		};
+
+		static constexpr uint64_t npos{ std::numeric_limits<uint64_t>::max() };
+		static constexpr uint64_t lruSampleCount{ 8 };
+
+		ObjectCacheShard shards[shardCount]{};
+		std::atomic_uint64_t byteCount{};
+		std::atomic_uint64_t count{};
+
+		static int64_t getCurrentTime() noexcept {
+			return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		static uint64_t getEntryFootprint(const OTy& value) noexcept {
+			return getCacheFootprint(value) + sizeof(ObjectCacheEntry) - sizeof(OTy) + sizeof(ObjectCacheSlot);
+		}
+
+		ObjectCacheShard& getShard(uint64_t hash) noexcept {
+			return this->shards[hash >> 58];
+		}
+
+		bool isItExpired(const ObjectCacheShard& shard, const ObjectCacheEntry& entry, int64_t currentTime) noexcept {
+			return shard.policy.ttlInMs != 0 && currentTime - entry.storedTime >= static_cast<int64_t>(shard.policy.ttlInMs);
+		}
+
+		/// Records an access for the eviction policy, which may be done concurrently under a shared lock, and checks the entry's time-to-live.
+		bool touchEntry(const ObjectCacheShard& shard, ObjectCacheEntry& entry) noexcept {
+			if (shard.policy.maxEntries == 0 && shard.policy.maxBytes == 0 && shard.policy.ttlInMs == 0) {
+				return true;
+			}
+			int64_t currentTime = ObjectCache::getCurrentTime();
+			if (this->isItExpired(shard, entry, currentTime)) {
+				return false;
+			}
+			if (shard.policy.evictionType == CacheEvictionType::Clock) {
+				entry.wasItAccessed.store(true, std::memory_order_relaxed);
+			} else {
+				entry.lastAccessTime.store(currentTime, std::memory_order_relaxed);
+			}
+			return true;
+		}
+
+		uint64_t findIndex(ObjectCacheShard& shard, const KeyType& key, uint64_t hash) noexcept {
+			if (shard.slots.size() == 0) {
+				return npos;
+			}
+			uint64_t mask = shard.slots.size() - 1;
+			for (uint64_t index = hash & mask; shard.slots[index].entry; index = (index + 1) & mask) {
+				if (shard.slots[index].key == key) {
+					return index;
+				}
+			}
+			return npos;
+		}
+
+		void insertValue(std::shared_ptr<ObjectCacheEntry>&& entry) {
+			KeyType key = getCacheKey(static_cast<const OTy&>(entry->value));
+			int64_t currentTime = ObjectCache::getCurrentTime();
+			entry->footprint = ObjectCache::getEntryFootprint(entry->value);
+			entry->lastAccessTime.store(currentTime, std::memory_order_relaxed);
+			entry->storedTime = currentTime;
+			uint64_t hash = getCacheHash(key);
+			auto& shard = this->getShard(hash);
+			std::unique_lock lock{ shard.accessMutex };
+			uint64_t index = this->findIndex(shard, key, hash);
+			const ObjectCacheEntry* writtenEntry{ entry.get() };
+			if (index != npos) {
+				this->removeFootprint(shard, shard.slots[index].entry->footprint);
+				this->addFootprint(shard, entry->footprint);
+				shard.slots[index].entry = std::move(entry);
+			} else {
+				if ((shard.count + 1) * 4 > shard.slots.size() * 3) {
+					this->growShard(shard);
+				}
+				this->addFootprint(shard, entry->footprint);
+				this->placeSlot(shard, ObjectCacheSlot{ std::move(entry), key }, hash);
+				++shard.count;
+				this->count.fetch_add(1, std::memory_order_relaxed);
+			}
+			this->evictWhileOverBudget(shard, currentTime, writtenEntry);
+		}
+
+		void addFootprint(ObjectCacheShard& shard, uint64_t footprint) noexcept {
+			shard.byteCount += footprint;
+			this->byteCount.fetch_add(footprint, std::memory_order_relaxed);
+		}
+
+		void removeFootprint(ObjectCacheShard& shard, uint64_t footprint) noexcept {
+			shard.byteCount -= footprint;
+			this->byteCount.fetch_sub(footprint, std::memory_order_relaxed);
+		}
+
+		bool isItOverBudget(const CachePolicy& policy) const noexcept {
+			return (policy.maxEntries != 0 && this->count.load(std::memory_order_relaxed) > policy.maxEntries) ||
+				(policy.maxBytes != 0 && this->byteCount.load(std::memory_order_relaxed) > policy.maxBytes);
+		}
+
+		/// Evicts from the written shard, whose lock is held, until the cache is back within its limits, sparing the entry just written;
+		/// if that shard runs out of other entries, the rest are evicted from whichever other shards can be locked without waiting, so
+		/// that no two writers can deadlock on each other's shards.
+		void evictWhileOverBudget(ObjectCacheShard& shard, int64_t currentTime, const ObjectCacheEntry* writtenEntry) {
+			while (this->isItOverBudget(shard.policy)) {
+				if (!this->evictOne(shard, currentTime, writtenEntry)) {
+					break;
+				}
+			}
+			for (auto& otherShard: this->shards) {
+				if (!this->isItOverBudget(shard.policy)) {
+					return;
+				}
+				if (&otherShard == &shard) {
+					continue;
+				}
+				std::unique_lock lock{ otherShard.accessMutex, std::try_to_lock };
+				while (lock.owns_lock() && this->isItOverBudget(shard.policy)) {
+					if (!this->evictOne(otherShard, currentTime, nullptr)) {
+						break;
+					}
+				}
+			}
+		}
+
+		bool evictOne(ObjectCacheShard& shard, int64_t currentTime, const ObjectCacheEntry* sparedEntry) {
+			if (shard.count <= (sparedEntry ? 1 : 0)) {
+				return false;
+			}
+			this->eraseIndex(shard, this->findVictim(shard, currentTime, sparedEntry));
+			return true;
+		}
+
+		/// Chooses an entry other than the spared one to evict, preferring expired entries; CLOCK gives each accessed entry a second
+		/// chance, while LRU takes the least-recently-accessed of a small sample of entries.
+		uint64_t findVictim(ObjectCacheShard& shard, int64_t currentTime, const ObjectCacheEntry* sparedEntry) noexcept {
+			uint64_t mask = shard.slots.size() - 1;
+			if (shard.policy.evictionType == CacheEvictionType::Clock) {
+				while (true) {
+					uint64_t index = shard.clockHand++ & mask;
+					auto& slot = shard.slots[index];
+					if (!slot.entry || slot.entry.get() == sparedEntry) {
+						continue;
+					}
+					if (this->isItExpired(shard, *slot.entry, currentTime) ||
+						!slot.entry->wasItAccessed.exchange(false, std::memory_order_relaxed)) {
+						return index;
+					}
+				}
+			}
+			uint64_t returnValue{ npos };
+			int64_t oldestTime{ std::numeric_limits<int64_t>::max() };
+			for (uint64_t x = 0; x < lruSampleCount; ++x) {
+				uint64_t index = mixCacheHash(++shard.clockHand) & mask;
+				while (!shard.slots[index].entry || shard.slots[index].entry.get() == sparedEntry) {
+					index = (index + 1) & mask;
+				}
+				auto& entry = *shard.slots[index].entry;
+				if (this->isItExpired(shard, entry, currentTime)) {
+					return index;
+				}
+				int64_t lastAccessTime = entry.lastAccessTime.load(std::memory_order_relaxed);
+				if (lastAccessTime < oldestTime) {
+					oldestTime = lastAccessTime;
+					returnValue = index;
+				}
+			}
+			return returnValue;
+		}
+
+		void eraseIndex(ObjectCacheShard& shard, uint64_t index) noexcept {
+			uint64_t mask = shard.slots.size() - 1;
+			this->removeFootprint(shard, shard.slots[index].entry->footprint);
+			shard.slots[index] = ObjectCacheSlot{};
+			for (uint64_t next = (index + 1) & mask; shard.slots[next].entry; next = (next + 1) & mask) {
+				uint64_t home = getCacheHash(shard.slots[next].key) & mask;
+				if (((next - home) & mask) >= ((next - index) & mask)) {
+					shard.slots[index] = std::move(shard.slots[next]);
+					shard.slots[next] = ObjectCacheSlot{};
+					index = next;
+				}
+			}
+			--shard.count;
+			this->count.fetch_sub(1, std::memory_order_relaxed);
 		}
 
+		void growShard(ObjectCacheShard& shard) {
+			std::vector<ObjectCacheSlot> oldSlots = std::move(shard.slots);
+			shard.slots = std::vector<ObjectCacheSlot>(oldSlots.size() == 0 ? 16 : oldSlots.size() * 2);
+			for (auto& value: oldSlots) {
+				if (value.entry) {
+					uint64_t hash = getCacheHash(value.key);
+					this->placeSlot(shard, std::move(value), hash);
+				}
+			}
+		}
+
+		void placeSlot(ObjectCacheShard& shard, ObjectCacheSlot&& slot, uint64_t hash) noexcept {
+			uint64_t mask = shard.slots.size() - 1;
+			uint64_t index = hash & mask;
+			while (shard.slots[index].entry) {
+				index = (index + 1) & mask;
+			}
+			shard.slots[index] = std::move(slot);
+		}
+	};
+
+	/// \brief A single interned string, held in a StringInterner's arena, along with the number of StringWrappers that hold it.
+	struct DiscordCoreAPI_Dll StringInternEntry {
+		std::atomic_uint32_t refCount{};///< The number of StringWrappers holding this string.
+		uint32_t length{};///< The length of the string, which follows this header.
+		uint64_t hash{};///< The hash of the string.
+		void* block{};///< The arena block that holds this entry.
+
+		char* data() noexcept;
+	};
+
+	/// \brief A thread-safe pool of reference-counted strings, which lets the caches share one copy of each repeated name.
+	/// Strings are packed into per-shard arena blocks, and a block is freed once none of its strings are held.
+	class DiscordCoreAPI_Dll StringInterner {
+	  public:
+		static constexpr uint64_t shardCount{ 16 };
+		static constexpr uint64_t blockSize{ 64 * 1024 };
+
+		/// \brief Enables or disables interning, for strings that are assigned through StringWrapper::intern() from now on.
+		/// \param enabledNew Whether or not to intern strings.
+		static void setEnabled(bool enabledNew) noexcept;
+
+		static bool isItEnabled() noexcept;
+
+		/// \brief Collects the entry for a string, adding it to the pool if needed, and takes a reference to it.
+		/// \param string The string to collect the entry for.
+		/// \returns The entry, with its reference count already incremented.
+		static StringInternEntry* acquire(std::string_view string);
+
+		/// \brief Releases a reference to an entry, removing it from the pool once no references remain.
+		/// \param entry The entry to release.
+		static void release(StringInternEntry* entry) noexcept;
+
+		/// \brief Collects the number of bytes held by the pool's arena blocks.
+		/// \returns The number of bytes.
+		static uint64_t getMemoryFootprint();
+
+		static uint64_t size();
+
 	  protected:
-		std::shared_mutex accessMutex{};
-		std::unordered_set<OTy> set{};
+		struct StringInternBlock {
+			uint64_t liveCount{};
+			uint64_t capacity{};
+			uint64_t used{};
+
+			char* data() noexcept;
+		};
+
+		struct alignas(64) StringInternerShard {
+			std::unordered_map<std::string_view, StringInternEntry*> entries{};
+			StringInternBlock* currentBlock{};
+			std::mutex accessMutex{};
+			uint64_t byteCount{};
+		};
+
+		static std::atomic_bool enabled;
+
+		static StringInternerShard* getShards();
+
+		static uint64_t getEntrySize(uint64_t length) noexcept;
+
+		static StringInternBlock* createBlock(uint64_t capacity);
 	};
 
+	/// \brief A compact string with a stored length, which keeps strings of up to inlineCapacity characters inside the object itself.
 	class DiscordCoreAPI_Dll StringWrapper {
 	  public:
+		static constexpr uint32_t inlineCapacity{ 15 };///< The longest string that is stored without a heap allocation.
+
 		StringWrapper() noexcept = default;
 
 		StringWrapper& operator=(StringWrapper&& other) noexcept;
 
+		StringWrapper(StringWrapper&& other) noexcept;
+
 		StringWrapper& operator=(const StringWrapper& other);
 
 		StringWrapper(const StringWrapper& other);
@@ -1226,61 +1752,110 @@ namespace DiscordCoreAPI {
 
 		explicit StringWrapper(const std::string& string);
 
+		StringWrapper& operator=(std::string_view string);
+
+		explicit StringWrapper(std::string_view string);
+
 		StringWrapper& operator=(const char* string);
 
 		StringWrapper(const char* string);
 
-		operator std::string();
+		operator std::string() const;
+
+		explicit operator std::string_view() const noexcept;
 
 		void emplace_back(char value);
 
-		uint64_t size();
+		uint64_t size() const noexcept;
+
+		bool empty() const noexcept;
+
+		const char* data() const noexcept;
+
+		/// \brief Collects the number of bytes held on the heap by this string, beyond the object itself.
+		/// \returns The number of bytes.
+		uint64_t getHeapFootprint() const noexcept;
 
-		const char* data();
+		/// \brief Creates a string that shares its storage with every other interned copy of it, if the StringInterner is enabled and the
+		/// string is too long to be stored inline.
+		/// \param string The string to be interned.
+		/// \returns The new StringWrapper.
+		static StringWrapper intern(std::string_view string);
+
+		~StringWrapper() noexcept;
 
 	  protected:
-		std::unique_ptr<char[]> ptr{};
+		static constexpr uint32_t internedCapacity{ std::numeric_limits<uint32_t>::max() };
+
+		union {
+			char inlineData[inlineCapacity + 1]{};
+			StringInternEntry* internedData;
+			char* heapData;
+		};
+		uint32_t capacity{ inlineCapacity };
+		uint32_t length{};
+
+		bool isItInterned() const noexcept;
+
+		bool isItInline() const noexcept;
+
+		void freeStorage() noexcept;
+
+		void assign(const char* string, uint64_t lengthNew);
+
+		void reserve(uint64_t capacityNew);
 	};
 
 	DiscordCoreAPI_Dll inline std::basic_ostream<char>& operator<<(std::basic_ostream<char, std::char_traits<char>>& lhs,
 		const StringWrapper& rhs) {
-		for (auto& value: static_cast<std::string>(static_cast<StringWrapper>(rhs))) {
-			lhs.put(value);
-		}
+		lhs.write(rhs.data(), static_cast<std::streamsize>(rhs.size()));
 		return lhs;
 	}
 
 	DiscordCoreAPI_Dll inline std::basic_string<char> operator+(
-		const std::basic_string<char, std::char_traits<char>, std::allocator<char>>& lhs, StringWrapper rhs) {
-		std::stringstream stream{};
-		stream << lhs << rhs;
-		return stream.str();
+		const std::basic_string<char, std::char_traits<char>, std::allocator<char>>& lhs, const StringWrapper& rhs) {
+		std::string returnValue{};
+		returnValue.reserve(lhs.size() + rhs.size());
+		returnValue.append(lhs);
+		returnValue.append(rhs.data(), rhs.size());
+		return returnValue;
 	}
 
-	DiscordCoreAPI_Dll inline std::basic_string<char> operator+(const char* lhs, StringWrapper rhs) {
-		std::stringstream stream{};
-		stream << lhs << rhs;
-		return stream.str();
+	DiscordCoreAPI_Dll inline std::basic_string<char> operator+(const char* lhs, const StringWrapper& rhs) {
+		std::string_view lhsNew{ lhs };
+		std::string returnValue{};
+		returnValue.reserve(lhsNew.size() + rhs.size());
+		returnValue.append(lhsNew);
+		returnValue.append(rhs.data(), rhs.size());
+		return returnValue;
 	}
 
-	DiscordCoreAPI_Dll inline bool operator==(StringWrapper lhs, const char* rhs) {
-		return static_cast<std::string>(lhs) == static_cast<std::string>(rhs);
+	DiscordCoreAPI_Dll inline std::basic_string<char> operator+(const StringWrapper& lhs, const char* rhs) {
+		std::string_view rhsNew{ rhs };
+		std::string returnValue{};
+		returnValue.reserve(lhs.size() + rhsNew.size());
+		returnValue.append(lhs.data(), lhs.size());
+		returnValue.append(rhsNew);
+		return returnValue;
 	}
 
-	DiscordCoreAPI_Dll inline bool operator!=(StringWrapper lhs, const char* rhs) {
-		return static_cast<std::string>(lhs) != rhs;
+	DiscordCoreAPI_Dll inline bool operator==(const StringWrapper& lhs, const char* rhs) {
+		return static_cast<std::string_view>(lhs) == std::string_view{ rhs };
 	}
 
-	DiscordCoreAPI_Dll inline bool operator==(std::string& lhs, StringWrapper& rhs) {
-		if (lhs.size() != rhs.size()) {
-			return false;
-		}
-		for (size_t x = 0; x < lhs.size(); ++x) {
-			if (lhs[x] != rhs.data()[x]) {
-				return false;
-			}
+	DiscordCoreAPI_Dll inline bool operator!=(const StringWrapper& lhs, const char* rhs) {
+		return static_cast<std::string_view>(lhs) != std::string_view{ rhs };
+	}
+
+	DiscordCoreAPI_Dll inline bool operator==(const std::string& lhs, const StringWrapper& rhs) {
+		return std::string_view{ lhs } == static_cast<std::string_view>(rhs);
+	}
+
+	DiscordCoreAPI_Dll inline bool operator==(const StringWrapper& lhs, const StringWrapper& rhs) {
+		if (lhs.data() == rhs.data() && lhs.size() == rhs.size()) {
+			return true;
 		}
-		return true;
+		return static_cast<std::string_view>(lhs) == static_cast<std::string_view>(rhs);
 	}
 
 	/**@}*/
@@ -1294,7 +1869,8 @@ namespace DiscordCoreAPI {
 	enum class AudioFrameType : uint8_t {
 		Unset = 0,///< Unset.
 		RawPCM = 1,///< Raw PCM.
-		Skip = 2///< Skip.
+		Skip = 2,///< Skip.
+		Encoded = 3///< A single 20ms, 48kHz stereo Opus packet, which is sent as-is.
 	};
 
 	/// \brief Represents a single frame of audio data.
@@ -1323,10 +1899,21 @@ namespace DiscordCoreAPI {
 		void clearData() noexcept;
 	};
 
+	/// \brief Settings for the Opus encoder of a VoiceConnection.
+	struct DiscordCoreAPI_Dll OpusEncoderOptions {
+		int32_t packetLossPercentage{};///< The packet loss to tune the in-band FEC for, as a percentage.
+		int32_t complexity{ 10 };///< The computational complexity of the encoder, from 0 to 10.
+		int32_t bitRate{};///< The target bitrate, in bits per second (0 for the maximum).
+		bool enableVbr{ true };///< Do we encode with a variable bitrate?
+		bool enableFec{};///< Do we add in-band forward error correction?
+		bool enableDtx{};///< Do we stop sending packets during silence (discontinuous transmission)?
+	};
+
 	/// For connecting to a voice-channel. "streamInfo" is used when a socket is created to connect this bot to another bot, for transmitting audio back and forth.
 	/// \brief For connecting to a voice-channel. "streamInfo" is used when a socket is created to connect this bot to another bot, for transmitting audio back and forth.
 	struct DiscordCoreAPI_Dll VoiceConnectInitData {
 		StreamInfo streamInfo{};///< The info for the stream-socekt, if applicable.
+		OpusEncoderOptions encoderOptions{};///< The settings for the outgoing audio's encoder.
 		int32_t currentShard{};///< The current websocket shard, if applicable.
 		Snowflake channelId{};///< The channel id to connect to.
 		Snowflake guildId{};///< The guild id to connect to.
@@ -1496,7 +2083,7 @@ namespace DiscordCoreAPI {
 
 		explicit Permissions(const uint64_t permsNew);
 
-		operator uint64_t();
+		operator uint64_t() const;
 
 		operator std::string();
 
@@ -1549,6 +2136,88 @@ namespace DiscordCoreAPI {
 		static std::string computeBasePermissions(const GuildMember& guildMember);
 	};
 
+	/// \brief A single Channel permission overwrite, reduced to its bitmasks.
+	struct DiscordCoreAPI_Dll PermissionOverwriteEntry {
+		uint64_t allow{};///< The Permissions to allow.
+		uint64_t deny{};///< The Permissions to deny.
+		uint64_t id{};///< The id of the Role or User that the overwrite applies to.
+	};
+
+	/// \brief The permission overwrites of a single Channel, split by what they apply to.
+	struct DiscordCoreAPI_Dll ChannelPermissionTable {
+		std::vector<PermissionOverwriteEntry> memberOverwrites{};///< The User overwrites, sorted by id.
+		std::vector<PermissionOverwriteEntry> roleOverwrites{};///< The Role overwrites, other than @everyone's, sorted by id.
+		PermissionOverwriteEntry everyoneOverwrite{};///< The @everyone overwrite, or an empty one.
+	};
+
+	/// \brief The Role Permissions and Channel overwrites of a single Guild, as maintained by the PermissionEngine.
+	struct DiscordCoreAPI_Dll GuildPermissionTable {
+		std::unordered_map<uint64_t, ChannelPermissionTable> channels{};///< The overwrite tables, by Channel id.
+		std::unordered_map<uint64_t, uint64_t> rolePermissions{};///< The Permissions of each Role, by Role id.
+		Snowflake ownerId{};///< The id of the Guild's owner.
+		Snowflake guildId{};///< The id of the Guild.
+	};
+
+	DiscordCoreAPI_Dll inline Snowflake getCacheKey(const GuildPermissionTable& object) {
+		return object.guildId;
+	}
+
+	DiscordCoreAPI_Dll uint64_t getCacheFootprint(const GuildPermissionTable& object) noexcept;
+
+	/// \brief Keeps the Permission bitmasks of every cached Guild's Roles and Channel overwrites, updated incrementally from the Role,
+	/// Channel and Guild events, so that a GuildMember's Permissions can be computed with integer operations alone.
+	class DiscordCoreAPI_Dll PermissionEngine {
+	  public:
+		/// \brief Sets the Permissions of a Role.
+		/// \param guildId The id of the Guild that the Role belongs to.
+		/// \param roleId The id of the Role.
+		/// \param permissions The Role's Permissions.
+		static void updateRole(const Snowflake guildId, const Snowflake roleId, uint64_t permissions);
+
+		/// \brief Removes a Role, as well as any Channel overwrites for it.
+		/// \param guildId The id of the Guild that the Role belonged to.
+		/// \param roleId The id of the Role.
+		static void removeRole(const Snowflake guildId, const Snowflake roleId);
+
+		/// \brief Replaces the overwrite table of a Channel with the Channel's current overwrites.
+		/// \param channel The Channel to collect the overwrites of.
+		static void updateChannel(const ChannelData& channel);
+
+		/// \brief Removes the overwrite table of a Channel.
+		/// \param guildId The id of the Guild that the Channel belonged to.
+		/// \param channelId The id of the Channel.
+		static void removeChannel(const Snowflake guildId, const Snowflake channelId);
+
+		/// \brief Sets the owner of a Guild.
+		/// \param guildId The id of the Guild.
+		/// \param ownerId The id of the Guild's owner.
+		static void updateOwner(const Snowflake guildId, const Snowflake ownerId);
+
+		/// \brief Removes every table belonging to a Guild.
+		/// \param guildId The id of the Guild.
+		static void removeGuild(const Snowflake guildId);
+
+		/// \brief Computes a GuildMember's Guild-wide Permissions.
+		/// \param guildMember The GuildMember to compute the Permissions of.
+		/// \param permissions The value to store the Permissions in.
+		/// \returns A bool representing whether or not the GuildMember's Guild and @everyone Role were present.
+		static bool computeBasePermissions(const GuildMemberData& guildMember, uint64_t& permissions);
+
+		/// \brief Computes a GuildMember's Permissions within a Channel.
+		/// \param guildMember The GuildMember to compute the Permissions of.
+		/// \param channelId The id of the Channel to compute the Permissions within.
+		/// \param permissions The value to store the Permissions in.
+		/// \returns A bool representing whether or not the GuildMember's Guild, @everyone Role and Channel were present.
+		static bool computeChannelPermissions(const GuildMemberData& guildMember, const Snowflake channelId, uint64_t& permissions);
+
+		static ObjectCache<GuildPermissionTable>& getCache();
+
+	  protected:
+		static ObjectCache<GuildPermissionTable> cache;
+
+		static bool computeBasePermissions(const GuildPermissionTable& table, const GuildMemberData& guildMember, uint64_t& permissions);
+	};
+
 	/// \brief Prints the current file, line, and column from which the function is being called - typically from within an exception's "catch" block.
 	/// \param currentFunctionName A string to display the current function's name.
 	/// \param location For deriving the current file, line, and column - do not set this value.
@@ -1558,8 +2227,6 @@ namespace DiscordCoreAPI {
 	DiscordCoreAPI_Dll void rethrowException(const std::string& currentFunctionName,
 		std::source_location location = std::source_location::current());
 
-	DiscordCoreAPI_Dll std::string constructMultiPartData(const std::string& data, const std::vector<File>& files);
-
 	DiscordCoreAPI_Dll std::string convertToLowerCase(const std::string& stringToConvert);
 
 	DiscordCoreAPI_Dll std::string base64Encode(const std::string&, bool = false);
@@ -1602,6 +2269,8 @@ namespace DiscordCoreAPI {
 
 		operator uint64_t();
 
+		uint64_t getTimeStampInTimeUnits() const noexcept;
+
 		TimeStamp& operator=(std::string&& originalTimeStampNew);
 
 		explicit TimeStamp(std::string&& originalTimeStampNew);
@@ -1825,7 +2494,7 @@ namespace DiscordCoreInternal {
 			if (this->head >= this->tail) {
 				return this->head - this->tail;
 			} else {
-				return this->tail - this->head;
+				return this->arrayValue.size() - (this->tail - this->head);
 			}
 		}
 
@@ -1881,6 +2550,13 @@ namespace DiscordCoreInternal {
 			this->modifyReadOrWritePosition(DiscordCoreInternal::RingBufferAccessType::Write, 1);
 		}
 
+		/// \brief Collects the slice that a given number of further writes will land in, so that it can be filled in place.
+		/// \param offset The number of writes past the current head.
+		/// \returns A pointer to the slice.
+		RingBufferInterface<OTy, 1024 * 16>* getSliceAhead(uint64_t offset) noexcept {
+			return this->arrayValue.data() + (this->head + offset) % this->arrayValue.size();
+		}
+
 		std::basic_string_view<OTy> readData() {
 			std::basic_string_view<OTy> returnValue{};
 			if (this->getCurrentTail()->getUsedSpace() > 0) {
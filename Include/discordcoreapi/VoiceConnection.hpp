@@ -28,24 +28,128 @@
 #include <discordcoreapi/FoundationEntities.hpp>
 #include <discordcoreapi/AudioEncoder.hpp>
 #include <discordcoreapi/AudioDecoder.hpp>
+#include <discordcoreapi/AudioMixer.hpp>
 #include <discordcoreapi/CoRoutine.hpp>
 #include <discordcoreapi/WebSocketEntities.hpp>
 #include <sodium.h>
 
+namespace DiscordCoreInternal {
+
+	class DiscordCoreAPI_Dll VoiceEngine;
+	struct DiscordCoreAPI_Dll VoiceEngineWorker;
+
+}
+
 namespace DiscordCoreAPI {
 
+	/// \brief The voice encryption modes that the library supports.
+	enum class VoiceEncryptionMode : uint8_t {
+		Unset = 0,///< No mode has been negotiated.
+		Aead_Aes256_Gcm_RtpSize = 1,///< AES-256-GCM - preferred wherever the CPU accelerates it.
+		Aead_XChaCha20_Poly1305_RtpSize = 2,///< XChaCha20-Poly1305.
+		XSalsa20_Poly1305 = 3///< XSalsa20-Poly1305 - deprecated by Discord.
+	};
+
 	struct DiscordCoreAPI_Dll VoiceSocketReadyData {
 		VoiceSocketReadyData(simdjson::ondemand::value);
+		VoiceEncryptionMode encryptionMode{};
 		std::string mode{};
 		std::string ip{};
 		uint64_t port{};
 		uint32_t ssrc{};
 	};
 
+	struct DiscordCoreAPI_Dll RTPPacketDecrypter;
+
+	/// \brief Loss and jitter statistics for a single user's incoming voice.
+	struct DiscordCoreAPI_Dll VoiceUserStats {
+		uint64_t packetsRecovered{};///< Lost packets that were rebuilt from the next packet's in-band FEC data.
+		uint64_t packetsConcealed{};///< Lost packets that were concealed by the decoder's PLC.
+		uint64_t packetsDiscarded{};///< Packets dropped to bring the buffer back down to its target depth.
+		uint64_t packetsReceived{};///< Packets accepted into the jitter buffer.
+		uint64_t targetDepth{};///< The current target depth of the jitter buffer, in packets.
+		uint64_t packetsLost{};///< Packets that never arrived in time to be played.
+		uint64_t packetsLate{};///< Packets that arrived after their turn to be played had passed.
+		float jitterMs{};///< The interarrival jitter, as defined by RFC 3550, in milliseconds.
+		Snowflake userId{};///< The user that the statistics belong to.
+	};
+
+	/// \brief Send-side pacing statistics for a single VoiceConnection.
+	struct DiscordCoreAPI_Dll VoicePacingStats {
+		static constexpr float lateThresholdMs{ 5.0f };///< How far behind its deadline a packet may be sent before it counts as late.
+
+		uint64_t ticksSkipped{};///< Ticks that were skipped while playing, rather than caught up on, after a stall longer than the burst.
+		uint64_t packetsSent{};///< Packets sent on a tick of the VoiceEngine.
+		uint64_t packetsLate{};///< Packets sent more than lateThresholdMs after their deadline.
+		float maxLatenessMs{};///< The furthest behind its deadline that any packet has been sent.
+		float latenessMs{};///< How far behind their deadlines packets are being sent, smoothed over roughly the last 16 packets.
+		float jitterMs{};///< The variation in the spacing of sent packets, relative to that of their deadlines, smoothed as in RFC 3550.
+	};
+
+	/// \brief The kinds of frame that a VoiceJitterBuffer can produce, on each tick.
+	enum class JitterBufferFrameType : uint8_t {
+		None = 0,///< Nothing to play - the buffer is (re)filling, or the user has stopped speaking.
+		Packet = 1,///< The next packet, in sequence.
+		Lost = 2///< The next packet is missing - the view holds the packet after it, for FEC, if that one has arrived.
+	};
+
+	/// \brief A frame produced by a VoiceJitterBuffer.
+	struct DiscordCoreAPI_Dll JitterBufferFrame {
+		std::basic_string_view<std::byte> packet{};///< The still-encrypted RTP packet, valid until the next insert.
+		JitterBufferFrameType type{};///< The kind of frame.
+	};
+
+	/// \brief Reorders a single SSRC's RTP packets by sequence number, and releases them at a steady rate, behind a depth that
+	/// adapts to the measured interarrival jitter.
+	class DiscordCoreAPI_Dll VoiceJitterBuffer {
+	  public:
+		static constexpr uint32_t frameSampleCount{ 960 };///< Samples per channel in a 20ms frame.
+		static constexpr uint64_t maxConcealedFrames{ 5 };
+		static constexpr uint64_t slotCount{ 32 };
+		static constexpr uint64_t maxDepth{ 8 };
+
+		/// \brief Adds a newly-arrived RTP packet to the buffer.
+		/// \param packet The packet, still encrypted.
+		void insertPacket(std::basic_string_view<std::byte> packet) noexcept;
+
+		/// \brief Collects the frame to play for the current tick.
+		/// \returns The frame.
+		JitterBufferFrame popFrame() noexcept;
+
+		VoiceUserStats& getStats() noexcept;
+
+	  protected:
+		struct DiscordCoreAPI_Dll JitterBufferSlot {
+			std::basic_string<std::byte> data{};
+			uint32_t timeStamp{};
+			uint16_t sequence{};
+			bool occupied{};
+		};
+
+		std::array<JitterBufferSlot, slotCount> slots{};
+		uint64_t consecutiveLost{};
+		uint64_t bufferedCount{};
+		bool areWeInitialized{};
+		VoiceUserStats stats{};
+		uint32_t lastTimeStamp{};
+		uint16_t nextSequence{};
+		int64_t lastArrival{};
+		bool areWePlaying{};
+		double jitter{};
+
+		void updateTargetDepth() noexcept;
+
+		void skipToEarliest() noexcept;
+
+		void reset() noexcept;
+	};
+
 	struct DiscordCoreAPI_Dll VoiceUser {
+		static constexpr uint64_t maxIdleTicks{ 250 };///< How long a user can go without speaking before their decoder is released - 5s.
+
 		VoiceUser() noexcept = default;
 
-		VoiceUser(Snowflake userId) noexcept;
+		VoiceUser(Snowflake userId, DiscordCoreInternal::OpusDecoderPool* decoderPoolNew) noexcept;
 
 		VoiceUser& operator=(VoiceUser&&) noexcept;
 
@@ -53,37 +157,91 @@ namespace DiscordCoreAPI {
 
 		VoiceUser(const VoiceUser&) noexcept = delete;
 
-		DiscordCoreInternal::OpusDecoderWrapper& getDecoder() noexcept;
-
-		std::basic_string_view<std::byte> extractPayload() noexcept;
+		/// \brief Decodes the user's next frame out of their jitter buffer, recovering or concealing it if it was lost.
+		/// Silence and DTX frames are never decoded, and the decoder is only taken from the pool once there is audio to decode.
+		/// \param decrypter The decrypter for the connection's packets.
+		/// \returns The decoded stereo samples, or an empty view if there is nothing to play for this tick.
+		std::basic_string_view<opus_int16> decodeNextFrame(RTPPacketDecrypter& decrypter);
 
 		void insertPayload(std::basic_string_view<std::byte>) noexcept;
 
+		VoiceUserStats getStats() noexcept;
+
+		void setGain(float gainNew) noexcept;
+
 		Snowflake getUserId() noexcept;
 
+		float getGain() noexcept;
+
+		~VoiceUser() noexcept;
+
 	  protected:
-		DiscordCoreInternal::RingBuffer<std::byte, 4> payloads{};
-		DiscordCoreInternal::OpusDecoderWrapper decoder{};
+		std::unique_ptr<DiscordCoreInternal::OpusDecoderWrapper> decoder{};
+		DiscordCoreInternal::OpusDecoderPool* decoderPool{ nullptr };
+		VoiceJitterBuffer jitterBuffer{};
+		uint64_t idleTicks{};
+		float gain{ 1.0f };
 		Snowflake userId{};
+
+		static bool isItSilence(std::basic_string_view<std::byte> payload) noexcept;
+
+		DiscordCoreInternal::OpusDecoderWrapper& getDecoder();
+
+		void releaseDecoder() noexcept;
 	};
 
 	struct DiscordCoreAPI_Dll RTPPacketEncrypter {
 		RTPPacketEncrypter() noexcept = default;
 
-		RTPPacketEncrypter(uint32_t ssrcNew, const std::basic_string<std::byte>& keysNew) noexcept;
+		RTPPacketEncrypter(uint32_t ssrcNew, const std::basic_string<std::byte>& keysNew, VoiceEncryptionMode modeNew) noexcept;
 
+		/// \brief Builds and encrypts an RTP packet around an encoded frame, in place, within the encrypter's packet buffer.
+		/// \param audioData The encoded frame.
+		/// \returns A view of the finished packet, which is valid until the next call.
 		std::basic_string_view<std::byte> encryptPacket(DiscordCoreInternal::EncoderReturnData& audioData) noexcept;
 
+		/// \brief Advances the timestamp over a frame that isn't being sent, such as one suppressed by DTX.
+		/// \param sampleCount The number of samples in the frame.
+		void skipFrame(size_t sampleCount) noexcept;
+
+		/// \brief Collects the mode matching one of Discord's encryption mode names.
+		/// \param modeName The name of the mode.
+		/// \returns The mode, or VoiceEncryptionMode::Unset if it isn't supported.
+		static VoiceEncryptionMode getEncryptionMode(std::string_view modeName) noexcept;
+
 	  protected:
+		crypto_aead_aes256gcm_state aesState{};
 		std::basic_string<std::byte> data{};
 		std::basic_string<std::byte> keys{};
+		uint8_t nonce[crypto_secretbox_NONCEBYTES]{};
+		VoiceEncryptionMode mode{};
 		uint8_t version{ 0x80 };
 		uint8_t flags{ 0x78 };
+		uint32_t nonceCount{};
 		uint32_t timeStamp{};
 		uint16_t sequence{};
 		uint32_t ssrc{};
 	};
 
+	/// \brief Decrypts incoming RTP packets, in any of the supported encryption modes.
+	struct DiscordCoreAPI_Dll RTPPacketDecrypter {
+		RTPPacketDecrypter() noexcept = default;
+
+		RTPPacketDecrypter(const std::basic_string<std::byte>& keysNew, VoiceEncryptionMode modeNew) noexcept;
+
+		/// \brief Decrypts an RTP packet, and strips its header extension, if it has one.
+		/// \param packet The packet to decrypt.
+		/// \returns A view of the packet's Opus payload, which is valid until the next call, or an empty view if it failed to decrypt.
+		std::basic_string_view<std::byte> decryptPacket(std::basic_string_view<std::byte> packet) noexcept;
+
+	  protected:
+		crypto_aead_aes256gcm_state aesState{};
+		std::basic_string<std::byte> data{};
+		std::basic_string<std::byte> keys{};
+		uint8_t nonce[crypto_secretbox_NONCEBYTES]{};
+		VoiceEncryptionMode mode{};
+	};
+
 	struct DiscordCoreAPI_Dll MovingAverager {
 		MovingAverager(size_t collectionCountNew) noexcept;
 
@@ -137,11 +295,7 @@ namespace DiscordCoreAPI {
 		friend class VoiceConnection;
 
 		VoiceConnectionBridge(DiscordCoreClient* voiceConnectionPtrNew, std::basic_string<std::byte>& encryptionKeyNew,
-			StreamType streamType, Snowflake guildIdNew);
-
-		inline void collectEightElements(opus_int32* dataIn, opus_int16* dataOut) noexcept;
-
-		inline void applyGainRamp(int64_t sampleCount) noexcept;
+			VoiceEncryptionMode encryptionMode, StreamType streamType, Snowflake guildIdNew);
 
 		void parseOutgoingVoiceData() noexcept;
 
@@ -150,16 +304,10 @@ namespace DiscordCoreAPI {
 		void mixAudio() noexcept;
 
 	  protected:
-		std::basic_string<std::byte> decryptedDataString{};
-		std::basic_string<opus_int16> downSampledVector{};
-		std::basic_string<opus_int32> upSampledVector{};
-		std::basic_string<std::byte> encryptionKey{};
-		MovingAverager voiceUserCountAverage{ 25 };
+		DiscordCoreInternal::AudioMixer mixer{};
+		RTPPacketDecrypter packetDecrypter{};
 		DiscordCoreClient* clientPtr{ nullptr };
 		Snowflake guildId{};
-		float currentGain{};
-		float increment{};
-		float endGain{};
 	};
 
 	/**
@@ -171,6 +319,7 @@ namespace DiscordCoreAPI {
 	  public:
 		friend class DiscordCoreInternal::BaseSocketAgent;
 		friend class DiscordCoreInternal::SoundCloudAPI;
+		friend class DiscordCoreInternal::VoiceEngine;
 		friend class DiscordCoreInternal::YouTubeAPI;
 		friend class VoiceConnectionBridge;
 		friend class DiscordCoreClient;
@@ -185,6 +334,19 @@ namespace DiscordCoreAPI {
 		/// \returns Snowflake A Snowflake containing the Channel's id.
 		Snowflake getChannelId() noexcept;
 
+		/// \brief Collects the loss and jitter statistics of every user currently being received from.
+		/// \returns A vector of VoiceUserStats, one per user.
+		std::vector<VoiceUserStats> getVoiceUserStats() noexcept;
+
+		/// \brief Sets the gain that a given user is mixed at, when their voice is being streamed.
+		/// \param userId The user to set the gain of.
+		/// \param gain The gain, where 1.0 leaves them unchanged, and 0.0 mutes them.
+		void setVoiceUserGain(Snowflake userId, float gain) noexcept;
+
+		/// \brief Collects the connection's send-side pacing statistics.
+		/// \returns A VoicePacingStats structure.
+		VoicePacingStats getPacingStats() noexcept;
+
 		/// \brief Connects to a currently held voice channel.
 		/// \param initData A DiscordCoerAPI::VoiceConnectInitDat structure.
 		void connect(const VoiceConnectInitData& initData) noexcept;
@@ -194,27 +356,39 @@ namespace DiscordCoreAPI {
 	  protected:
 		std::atomic<VoiceConnectionState> connectionState{ VoiceConnectionState::Collecting_Init_Data };
 		UnboundedMessageBlock<DiscordCoreInternal::VoiceConnectionData> voiceConnectionDataBuffer{};
-		Nanoseconds intervalCount{ static_cast<int64_t>(960.0l / 48000.0l * 1000000000.0l) };
 		std::atomic<VoiceActiveState> activeState{ VoiceActiveState::Connecting };
+		DiscordCoreInternal::OpusDecoderPool decoderPool{};
 		std::unordered_map<uint64_t, std::unique_ptr<VoiceUser>> voiceUsers{};
+		std::unordered_map<uint64_t, float> voiceUserGains{};
+		DiscordCoreInternal::VoiceEngineWorker* voiceEngineWorker{ nullptr };
 		DiscordCoreInternal::VoiceConnectionData voiceConnectionData{};
+		SteadyClock::time_point lastPacketDeadline{};
 		std::unique_ptr<VoiceConnectionBridge> streamSocket{ nullptr };
+		VoiceActiveState lastActiveState{ VoiceActiveState::Connecting };
 		DiscordCoreInternal::WebSocketClient* baseShard{ nullptr };
-		DiscordCoreInternal::RingBuffer<std::byte, 4> audioData{};
-		std::unique_ptr<std::jthread> taskThread01{ nullptr };
+		std::unique_ptr<std::jthread> handshakeThread{ nullptr };
+		DiscordCoreInternal::VoiceEngine* voiceEngine{ nullptr };
+		StopWatch<Milliseconds> datagramStopWatch{ 20000ms };
 		DiscordCoreInternal::OpusEncoderWrapper encoder{};
 		DiscordCoreClient* discordCoreClient{ nullptr };
 		std::basic_string<std::byte> encryptionKey{};
+		std::basic_string<std::byte> pendingEncodedFrame{};
+		std::basic_string<std::byte> pendingAudio{};
 		VoiceConnectInitData voiceConnectInitData{};
 		std::atomic_bool* doWeQuit{ nullptr };
 		int64_t sampleRatePerSecond{ 48000 };
 		RTPPacketEncrypter packetEncrypter{};
 		simdjson::ondemand::parser parser{};
-		int64_t nsPerSecond{ 1000000000 };
+		VoiceEncryptionMode encryptionMode{};
 		std::string audioEncryptionMode{};
+		SteadyClock::time_point lastPacketSendTime{};
+		std::atomic_bool areWeHandshaking{};
 		Snowflake currentGuildMemberId{};
+		uint64_t pendingAudioOffset{};
 		std::atomic_bool areWePlaying{};
 		AudioFrameData xferAudioData{};
+		VoicePacingStats pacingStats{};
+		bool isPacketPending{};
 		int64_t samplesPerPacket{};
 		std::string externalIp{};
 		int64_t msPerPacket{};
@@ -225,6 +399,16 @@ namespace DiscordCoreAPI {
 
 		void parseIncomingVoiceData(std::basic_string_view<std::byte> rawDataBufferNew) noexcept;
 
+		/// \brief Starts tracking a user who has begun speaking, unless bot audio isn't streamed and the User cache says they're a bot.
+		/// Users missing from the cache are treated as not being bots, so that no request is ever made from the voice threads.
+		/// \param ssrc The user's SSRC.
+		/// \param userId The user's id.
+		void addVoiceUser(uint32_t ssrc, Snowflake userId) noexcept;
+
+		/// \brief Locks the VoiceEngine thread that services this connection, for changes made to the voice users from another thread.
+		/// \returns The lock, which holds nothing if the connection is not registered with a VoiceEngine.
+		std::unique_lock<std::recursive_mutex> lockVoiceEngineWorker() noexcept;
+
 		UnboundedMessageBlock<AudioFrameData>& getAudioBuffer() noexcept;
 
 		void checkForAndSendHeartBeat(const bool isItImmediage) noexcept;
@@ -237,7 +421,26 @@ namespace DiscordCoreAPI {
 
 		void connectInternal(std::stop_token token) noexcept;
 
-		void runVoice(std::stop_token) noexcept;
+		/// \brief Advances the connection by one tick of its VoiceEngine, queueing the next packet of audio, if there is one.
+		void prepareVoiceFrame() noexcept;
+
+		/// \brief Flushes the packet queued by prepareVoiceFrame(), and collects any incoming datagrams.
+		/// \param deadline The deadline of the tick that the packet belongs to.
+		void flushVoiceFrame(SteadyClock::time_point deadline) noexcept;
+
+		/// \brief Updates the pacing statistics with a packet that has just been sent.
+		/// \param deadline The deadline of the tick that the packet belongs to.
+		/// \param sendTime When the packet was sent.
+		void recordPacketSent(SteadyClock::time_point deadline, SteadyClock::time_point sendTime) noexcept;
+
+		/// \brief Services the voice websocket, once the VoiceEngine has found it to be readable.
+		void processControlSocket() noexcept;
+
+		/// \brief Moves enough of the SongAPI's audio into the pending buffer to fill one packet, or collects its next pre-encoded frame.
+		/// \returns A bool representing whether or not a full packet of audio is now pending.
+		bool collectPendingAudio() noexcept;
+
+		void startHandshake() noexcept;
 
 		bool areWeCurrentlyPlaying() noexcept;
 
@@ -265,4 +468,80 @@ namespace DiscordCoreAPI {
 	};
 	/**@}*/
 
-};// namespace DiscordCoreAPI
\ No newline at end of file
+};// namespace DiscordCoreAPI
+namespace DiscordCoreInternal {
+
+	/// \brief A single thread of the VoiceEngine, along with the VoiceConnections that it services.
+	struct DiscordCoreAPI_Dll VoiceEngineWorker {
+		std::unordered_map<DiscordCoreAPI::VoiceConnection*, SOCKET> controlSockets{};///< The websocket registered for each connection.
+		std::vector<DiscordCoreAPI::VoiceConnection*> connections{};///< The connections serviced by this thread.
+		std::recursive_mutex accessMutex{};///< Held for as long as the thread is touching any of its connections.
+		std::jthread thread{};///< The thread itself.
+		int32_t pollHandle{ -1 };///< The epoll instance that the control sockets are registered with, where available.
+	};
+
+	/// \brief Paces a VoiceEngine thread's ticks against absolute, monotonic deadlines - epoch + n * interval - so that neither the
+	/// time spent in a tick nor the scheduler's wake-up latency accumulates as drift, and lets the ticks missed during a stall be
+	/// run back-to-back, up to a bound, rather than being lost.
+	class DiscordCoreAPI_Dll VoicePacingClock {
+	  public:
+		static constexpr uint64_t maxCatchUpTicks{ 5 };///< The most missed ticks to run back-to-back after a stall - 100ms of audio.
+
+		VoicePacingClock(Nanoseconds intervalNew) noexcept;
+
+		/// \brief Collects the deadline of the next tick.
+		/// \returns The deadline.
+		SteadyClock::time_point getDeadline() const noexcept;
+
+		/// \brief Collects how many ticks are due, skipping past any that were missed beyond maxCatchUpTicks.
+		/// \param now The current time.
+		/// \returns The number of ticks to run back-to-back, each followed by advance().
+		uint64_t collectDueTicks(SteadyClock::time_point now) noexcept;
+
+		/// \brief Moves the deadline on by one interval, once a tick has been run.
+		void advance() noexcept;
+
+		/// \brief Collects the number of ticks that collectDueTicks() has skipped, in total.
+		/// \returns The number of ticks.
+		uint64_t getSkippedTicks() const noexcept;
+
+	  protected:
+		SteadyClock::time_point epoch{};
+		Nanoseconds interval{};
+		uint64_t skippedTicks{};
+		uint64_t tickIndex{};
+	};
+
+	/// \brief Services every VoiceConnection on a small, fixed set of threads that share one 20ms tick.
+	/// Each tick encodes and encrypts every Playing connection's next packet, and then flushes them all, while the voice websockets
+	/// are only serviced when epoll (or poll, elsewhere) finds them readable, in between ticks.
+	class DiscordCoreAPI_Dll VoiceEngine {
+	  public:
+		/// \brief Constructs the engine, and starts its threads.
+		/// \param threadCount The number of threads to start - with 0, one per four hardware threads is used.
+		VoiceEngine(uint32_t threadCount);
+
+		/// \brief Hands a VoiceConnection to the least-loaded thread, if it isn't already being serviced.
+		/// \param connection The connection to add.
+		void addConnection(DiscordCoreAPI::VoiceConnection* connection) noexcept;
+
+		/// \brief Stops servicing a VoiceConnection, waiting for its thread to finish any tick that it is in the middle of.
+		/// \param connection The connection to remove.
+		void removeConnection(DiscordCoreAPI::VoiceConnection* connection) noexcept;
+
+		~VoiceEngine() noexcept;
+
+	  protected:
+		std::vector<std::unique_ptr<VoiceEngineWorker>> workers{};
+		const Nanoseconds tickInterval{ 20ms };
+
+		void waitForControlEvents(VoiceEngineWorker& worker, SteadyClock::time_point deadline) noexcept;
+
+		void registerControlSockets(VoiceEngineWorker& worker) noexcept;
+
+		void run(VoiceEngineWorker& worker, std::stop_token token) noexcept;
+
+		void tick(VoiceEngineWorker& worker, SteadyClock::time_point deadline, uint64_t skippedTicks) noexcept;
+	};
+
+}// namespace DiscordCoreInternal
@@ -32,6 +32,8 @@
 #include <discordcoreapi/EventEntities.hpp>
 #include <discordcoreapi/SSLClients.hpp>
 #include <discordcoreapi/ThreadPool.hpp>
+#include <condition_variable>
+#include <unordered_set>
 
 namespace DiscordCoreInternal {
 
@@ -116,6 +118,79 @@ namespace DiscordCoreInternal {
 		uint32_t shard[2]{};
 	};
 
+	/// \brief A raw Guild event, waiting to be parsed and cached by one of the GuildIngestionPipeline's lanes.
+	struct DiscordCoreAPI_Dll GuildIngestionTask {
+		std::string payload{};///< The event's Json payload, with its simdjson padding already reserved.
+		uint32_t shard{};///< The shard that the event was received on.
+	};
+
+	/// \brief The Guilds that a shard's READY payload listed, which have not yet been ingested.
+	struct DiscordCoreAPI_Dll GuildsReadyState {
+		std::unordered_set<uint64_t> pendingGuilds{};///< The Guilds still waiting on their GUILD_CREATE.
+		uint64_t guildCount{};///< The number of Guilds that the READY payload listed.
+	};
+
+	/// \brief Parses and caches GUILD_CREATE/UPDATE/DELETE events, along with every other Guild-scoped event (Channels, Threads,
+	/// GuildMembers, Roles, bans, emoji, stickers, scheduled events, stage instances, presences and voice states), on a bounded set of
+	/// worker threads, while the websocket keeps reading. Each Guild always maps to the same lane, so its events are applied in the order
+	/// that they were received, and never ahead of a GUILD_CREATE that is still queued - which means that the handlers of these events run
+	/// on the lanes, concurrently across Guilds, rather than on the websocket thread.
+	class DiscordCoreAPI_Dll GuildIngestionPipeline {
+	  public:
+		/// \brief The number of events that a lane may hold before the websocket thread blocks on it.
+		static constexpr uint64_t laneCapacity{ 32 };
+
+		/// \brief Constructs the pipeline.
+		/// \param discordCoreClientNew The client whose caches and events are to be used.
+		/// \param threadCount The number of lanes to start - with 0, every event is processed inline, on the websocket thread.
+		GuildIngestionPipeline(DiscordCoreAPI::DiscordCoreClient* discordCoreClientNew, uint32_t threadCount);
+
+		/// \brief Records the Guilds listed in a shard's READY payload, so that onGuildsReady can be fired once they've all arrived.
+		/// \param shard The shard that received the READY payload.
+		/// \param guildIds The Guilds that the READY payload listed.
+		void expectGuilds(uint32_t shard, const std::vector<DiscordCoreAPI::Snowflake>& guildIds);
+
+		/// \brief Queues a Guild event on its Guild's lane, blocking while that lane is full, or drops it once the pipeline is stopping.
+		/// \param guildId The id of the Guild that the event concerns.
+		/// \param shard The shard that the event was received on.
+		/// \param payload The event's Json payload.
+		void submit(uint64_t guildId, uint32_t shard, std::string&& payload);
+
+		/// \brief Builds the event data for a parsed Guild event, caches it, and fires its event.
+		/// \param eventType The EventConverter value of the event - 8 to 37 (other than 11), 52 to 55, or 58.
+		/// \param message The event's outer message.
+		/// \param dValue The event's whole Json payload.
+		/// \param shard The shard that the event was received on.
+		void processGuildEvent(int32_t eventType, WebSocketMessage& message, simdjson::ondemand::value dValue, uint32_t shard);
+
+		/// \brief Checks whether events are being handed off to the lanes, rather than processed inline.
+		/// \returns A bool representing whether or not any lanes were started.
+		bool isItEnabled() const noexcept;
+
+		~GuildIngestionPipeline() noexcept;
+
+	  protected:
+		/// \brief A single worker thread, along with its queue and parser.
+		struct GuildIngestionLane {
+			std::condition_variable_any taskCondVar{};
+			std::condition_variable_any spaceCondVar{};
+			simdjson::ondemand::parser parser{};
+			std::deque<GuildIngestionTask> tasks{};
+			std::mutex accessMutex{};
+			std::jthread thread{};
+		};
+
+		std::unordered_map<uint32_t, GuildsReadyState> readyStates{};
+		std::vector<std::unique_ptr<GuildIngestionLane>> lanes{};
+		std::atomic_bool doWeQuit{};
+		DiscordCoreAPI::DiscordCoreClient* discordCoreClient{ nullptr };
+		std::mutex readyStateMutex{};
+
+		void markGuildIngested(uint32_t shard, uint64_t guildId);
+
+		void run(std::stop_token token, GuildIngestionLane& lane) noexcept;
+	};
+
 	class DiscordCoreAPI_Dll WebSocketClient : public WebSocketCore {
 	  public:
 		friend struct DiscordCoreAPI::OnVoiceServerUpdateData;
@@ -129,6 +204,8 @@ namespace DiscordCoreInternal {
 
 		WebSocketClient(DiscordCoreAPI::DiscordCoreClient* client, int32_t currentShardNew, std::atomic_bool* doWeQuitNew);
 
+		void collectVoiceState(const DiscordCoreAPI::VoiceStateData& data);
+
 		void getVoiceConnectionData(const DiscordCoreAPI::VoiceConnectInitData& doWeCollect) noexcept;
 
 		bool onMessageReceived(std::string_view message) noexcept;
@@ -0,0 +1,406 @@
+/*
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2021, 2022 Chris M. (RealTimeChris)
+
+	This library is free software; you can redistribute it and/or
+	modify it under the terms of the GNU Lesser General Public
+	License as published by the Free Software Foundation; either
+	version 2.1 of the License, or (at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+	Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public
+	License along with this library; if not, write to the Free Software
+	Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+	USA
+*/
+/// AudioCache.cpp - Source file for the on-disk cache of encoded songs.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file AudioCache.cpp
+
+#include <discordcoreapi/AudioCache.hpp>
+
+namespace DiscordCoreInternal {
+
+	AudioCacheWriter::AudioCacheWriter(AudioCache* cacheNew, uint64_t keyNew, std::shared_ptr<AudioCacheEntry> entryNew,
+		std::ofstream&& fileNew) {
+		this->size = entryNew->size;
+		this->entry = std::move(entryNew);
+		this->file = std::move(fileNew);
+		this->cache = cacheNew;
+		this->key = keyNew;
+	}
+
+	void AudioCacheWriter::writeFrame(const DiscordCoreAPI::AudioFrameData& frame) {
+		if (this->isItDone || frame.currentSize <= 0) {
+			return;
+		}
+		std::basic_string_view<std::byte> data{ frame.data.data(), static_cast<uint64_t>(frame.currentSize) };
+		if (frame.type == DiscordCoreAPI::AudioFrameType::Encoded) {
+			this->writeRecord(data);
+		} else if (frame.type == DiscordCoreAPI::AudioFrameType::RawPCM) {
+			this->pendingSamples.append(data);
+			uint64_t offset{};
+			while (this->pendingSamples.size() - offset >= pcmFrameSize && !this->isItDone) {
+				this->encodeAndWrite(std::basic_string_view<std::byte>{ this->pendingSamples.data() + offset, pcmFrameSize });
+				offset += pcmFrameSize;
+			}
+			this->pendingSamples.erase(0, offset);
+		}
+	}
+
+	void AudioCacheWriter::complete() {
+		if (this->pendingSamples.size() > 0 && !this->isItDone) {
+			this->pendingSamples.resize(pcmFrameSize, std::byte{ 0 });
+			this->encodeAndWrite(this->pendingSamples);
+			this->pendingSamples.clear();
+		}
+		if (this->isItDone) {
+			return;
+		}
+		const char terminator[2]{};
+		this->file.write(terminator, sizeof(terminator));
+		this->file.flush();
+		if (!this->file) {
+			this->abort();
+			return;
+		}
+		this->file.close();
+		this->size += sizeof(terminator);
+		{
+			std::unique_lock lock{ this->entry->accessMutex };
+			this->entry->size = this->size;
+			this->entry->isItComplete = true;
+		}
+		this->entry->growthCondition.notify_all();
+		this->isItDone = true;
+		this->cache->completeEntry(this->key, this->size);
+	}
+
+	void AudioCacheWriter::encodeAndWrite(std::basic_string_view<std::byte> samples) {
+		try {
+			if (!this->encoder) {
+				this->encoder = std::make_unique<OpusEncoderWrapper>();
+			}
+			auto encodedData = this->encoder->encodeData(samples);
+			if (encodedData.data.size() > 0) {
+				this->writeRecord(encodedData.data);
+			}
+		} catch (...) {
+			DiscordCoreAPI::reportException("AudioCacheWriter::encodeAndWrite()");
+			this->abort();
+		}
+	}
+
+	void AudioCacheWriter::writeRecord(std::basic_string_view<std::byte> record) {
+		if (record.size() == 0 || record.size() > std::numeric_limits<uint16_t>::max()) {
+			return;
+		}
+		const char length[2]{ static_cast<char>(record.size() & 0xff), static_cast<char>(record.size() >> 8) };
+		this->file.write(length, sizeof(length));
+		this->file.write(reinterpret_cast<const char*>(record.data()), static_cast<std::streamsize>(record.size()));
+		this->size += sizeof(length) + record.size();
+		if (!this->file || this->size > this->cache->maxSizeInBytes) {
+			this->abort();
+			return;
+		}
+		if (++this->framesSincePublish >= framesPerPublish) {
+			this->publish();
+		}
+	}
+
+	void AudioCacheWriter::publish() {
+		this->framesSincePublish = 0;
+		this->file.flush();
+		{
+			std::unique_lock lock{ this->entry->accessMutex };
+			this->entry->size = this->size;
+		}
+		this->entry->growthCondition.notify_all();
+	}
+
+	void AudioCacheWriter::abort() noexcept {
+		if (this->isItDone) {
+			return;
+		}
+		this->isItDone = true;
+		this->file.close();
+		this->cache->abortEntry(this->key, this->entry);
+	}
+
+	AudioCacheWriter::~AudioCacheWriter() noexcept {
+		this->abort();
+	}
+
+	AudioCacheReader::AudioCacheReader(AudioCache* cacheNew, uint64_t keyNew, std::shared_ptr<AudioCacheEntry> entryNew,
+		std::ifstream&& fileNew, uint64_t offsetNew) {
+		this->entry = std::move(entryNew);
+		this->file = std::move(fileNew);
+		this->offset = offsetNew;
+		this->cache = cacheNew;
+		this->key = keyNew;
+		this->file.seekg(static_cast<std::streamoff>(this->offset));
+	}
+
+	bool AudioCacheReader::readFrame(DiscordCoreAPI::AudioFrameData& frame, std::stop_token token) {
+		{
+			std::unique_lock lock{ this->entry->accessMutex };
+			if (!this->entry->growthCondition.wait(lock, token, [this] {
+					return this->entry->size > this->offset || this->entry->haveWeFailed;
+				}) ||
+				this->entry->haveWeFailed) {
+				return false;
+			}
+		}
+		uint8_t length[2]{};
+		if (!this->file.read(reinterpret_cast<char*>(length), sizeof(length))) {
+			return false;
+		}
+		const uint64_t recordSize{ static_cast<uint64_t>(length[0]) | static_cast<uint64_t>(length[1]) << 8 };
+		this->offset += sizeof(length);
+		if (recordSize == 0) {
+			return false;
+		}
+		frame.data.resize(recordSize);
+		if (!this->file.read(reinterpret_cast<char*>(frame.data.data()), static_cast<std::streamsize>(recordSize))) {
+			return false;
+		}
+		this->offset += recordSize;
+		frame.type = DiscordCoreAPI::AudioFrameType::Encoded;
+		frame.currentSize = static_cast<int64_t>(recordSize);
+		return true;
+	}
+
+	bool AudioCacheReader::haveWeFailed() {
+		std::unique_lock lock{ this->entry->accessMutex };
+		return this->entry->haveWeFailed;
+	}
+
+	AudioCacheReader::~AudioCacheReader() noexcept {
+		this->file.close();
+		this->cache->releaseReader(this->key, this->entry);
+	}
+
+	AudioCache::AudioCache(const std::string& directoryNew, uint64_t maxSizeInBytesNew) {
+		this->maxSizeInBytes = maxSizeInBytesNew;
+		this->directory = directoryNew;
+		std::error_code errorCode{};
+		std::filesystem::create_directories(this->directory, errorCode);
+		if (errorCode) {
+			throw DiscordCoreAPI::DCAException{ "Failed to create the audio cache's directory, Reason: " + errorCode.message() };
+		}
+		std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> files{};
+		for (auto& value: std::filesystem::directory_iterator{ this->directory, errorCode }) {
+			if (value.path().extension() == ".cache" && value.is_regular_file(errorCode)) {
+				files.emplace_back(value.last_write_time(errorCode), value.path());
+			}
+		}
+		std::sort(files.begin(), files.end());
+		std::unique_lock lock{ this->accessMutex };
+		for (auto& [writeTime, path]: files) {
+			this->loadEntry(path);
+		}
+		this->evictEntries();
+	}
+
+	std::unique_ptr<AudioCacheWriter> AudioCache::beginWrite(const DiscordCoreAPI::Song& song) {
+		if (song.songId.empty()) {
+			return nullptr;
+		}
+		const std::string songKey{ AudioCache::getSongKey(song) };
+		const uint64_t key{ AudioCache::hashSongKey(songKey) };
+		std::unique_lock lock{ this->accessMutex };
+		if (this->entries.contains(key)) {
+			return nullptr;
+		}
+		auto entry = std::make_shared<AudioCacheEntry>();
+		entry->path = this->getPath(key);
+		std::ofstream file{ entry->path, std::ios::binary | std::ios::trunc };
+		const std::string header{ AudioCache::getFileHeader(songKey) };
+		if (!file.write(header.data(), static_cast<std::streamsize>(header.size()))) {
+			return nullptr;
+		}
+		entry->lastAccess = ++this->accessCounter;
+		entry->size = header.size();
+		entry->songKey = songKey;
+		this->entries[key] = entry;
+		return std::make_unique<AudioCacheWriter>(this, key, std::move(entry), std::move(file));
+	}
+
+	std::unique_ptr<AudioCacheReader> AudioCache::openReader(const DiscordCoreAPI::Song& song) {
+		if (song.songId.empty()) {
+			return nullptr;
+		}
+		const std::string songKey{ AudioCache::getSongKey(song) };
+		const uint64_t key{ AudioCache::hashSongKey(songKey) };
+		std::unique_lock lock{ this->accessMutex };
+		auto iterator = this->entries.find(key);
+		if (iterator == this->entries.end() || iterator->second->songKey != songKey) {
+			return nullptr;
+		}
+		auto entry = iterator->second;
+		bool isItComplete{};
+		{
+			std::unique_lock entryLock{ entry->accessMutex };
+			if (entry->haveWeFailed) {
+				return nullptr;
+			}
+			isItComplete = entry->isItComplete;
+		}
+		std::ifstream file{ entry->path, std::ios::binary };
+		if (!file) {
+			return nullptr;
+		}
+		if (isItComplete) {
+			std::error_code errorCode{};
+			std::filesystem::last_write_time(entry->path, std::filesystem::file_time_type::clock::now(), errorCode);
+		}
+		entry->lastAccess = ++this->accessCounter;
+		++entry->readerCount;
+		return std::make_unique<AudioCacheReader>(this, key, std::move(entry), std::move(file), AudioCache::getFileHeader(songKey).size());
+	}
+
+	uint64_t AudioCache::getSize() {
+		std::unique_lock lock{ this->accessMutex };
+		return this->totalSize;
+	}
+
+	std::string AudioCache::getSongKey(const DiscordCoreAPI::Song& song) {
+		return (song.type == DiscordCoreAPI::SongType::SoundCloud ? "soundcloud:" : "youtube:") + song.songId;
+	}
+
+	uint64_t AudioCache::hashSongKey(std::string_view songKey) {
+		uint64_t hash{ 14695981039346656037ull };
+		for (auto& value: songKey) {
+			hash ^= static_cast<uint8_t>(value);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	std::string AudioCache::getFileHeader(std::string_view songKey) {
+		std::string header{};
+		for (uint64_t x = 0; x < sizeof(magic); ++x) {
+			header.push_back(static_cast<char>((magic >> (x * 8)) & 0xff));
+		}
+		header.push_back(static_cast<char>(version));
+		header.push_back(static_cast<char>(songKey.size() & 0xff));
+		header.push_back(static_cast<char>((songKey.size() >> 8) & 0xff));
+		header.append(songKey.substr(0, std::numeric_limits<uint16_t>::max()));
+		return header;
+	}
+
+	std::filesystem::path AudioCache::getPath(uint64_t key) {
+		std::stringstream stream{};
+		stream << std::hex << std::setw(16) << std::setfill('0') << key << ".cache";
+		return this->directory / stream.str();
+	}
+
+	void AudioCache::loadEntry(const std::filesystem::path& path) {
+		std::error_code errorCode{};
+		const uint64_t size{ std::filesystem::file_size(path, errorCode) };
+		std::string songKey{};
+		if (!errorCode) {
+			std::ifstream file{ path, std::ios::binary };
+			char prefix[7]{};
+			if (file.read(prefix, sizeof(prefix))) {
+				songKey.resize(static_cast<uint64_t>(static_cast<uint8_t>(prefix[5])) |
+					static_cast<uint64_t>(static_cast<uint8_t>(prefix[6])) << 8);
+				file.read(songKey.data(), static_cast<std::streamsize>(songKey.size()));
+			}
+			char terminator[2]{ 1, 1 };
+			if (file && size >= sizeof(prefix) + songKey.size() + sizeof(terminator)) {
+				file.seekg(static_cast<std::streamoff>(size - sizeof(terminator)));
+				file.read(terminator, sizeof(terminator));
+			}
+			const std::string header{ AudioCache::getFileHeader(songKey) };
+			if (!file || terminator[0] != 0 || terminator[1] != 0 || path != this->getPath(AudioCache::hashSongKey(songKey)) ||
+				header.compare(0, sizeof(prefix), prefix, sizeof(prefix)) != 0) {
+				errorCode = std::make_error_code(std::errc::invalid_argument);
+			}
+		}
+		if (errorCode) {
+			std::filesystem::remove(path, errorCode);
+			return;
+		}
+		auto entry = std::make_shared<AudioCacheEntry>();
+		entry->lastAccess = ++this->accessCounter;
+		entry->songKey = std::move(songKey);
+		entry->isItComplete = true;
+		entry->path = path;
+		entry->size = size;
+		this->entries[AudioCache::hashSongKey(entry->songKey)] = std::move(entry);
+		this->totalSize += size;
+	}
+
+	void AudioCache::completeEntry(uint64_t key, uint64_t size) {
+		std::unique_lock lock{ this->accessMutex };
+		if (this->entries.contains(key)) {
+			this->entries[key]->lastAccess = ++this->accessCounter;
+		}
+		this->totalSize += size;
+		this->evictEntries();
+	}
+
+	void AudioCache::abortEntry(uint64_t key, const std::shared_ptr<AudioCacheEntry>& entry) {
+		{
+			std::unique_lock lock{ entry->accessMutex };
+			entry->haveWeFailed = true;
+		}
+		entry->growthCondition.notify_all();
+		std::unique_lock lock{ this->accessMutex };
+		if (entry->readerCount == 0 && this->entries.contains(key) && this->entries[key] == entry) {
+			std::error_code errorCode{};
+			std::filesystem::remove(entry->path, errorCode);
+			this->entries.erase(key);
+		}
+	}
+
+	void AudioCache::releaseReader(uint64_t key, const std::shared_ptr<AudioCacheEntry>& entry) {
+		std::unique_lock lock{ this->accessMutex };
+		if (--entry->readerCount > 0) {
+			return;
+		}
+		bool haveWeFailed{};
+		{
+			std::unique_lock entryLock{ entry->accessMutex };
+			haveWeFailed = entry->haveWeFailed;
+		}
+		if (!haveWeFailed) {
+			this->evictEntries();
+		} else if (this->entries.contains(key) && this->entries[key] == entry) {
+			std::error_code errorCode{};
+			std::filesystem::remove(entry->path, errorCode);
+			this->entries.erase(key);
+		}
+	}
+
+	void AudioCache::evictEntries() {
+		while (this->totalSize > this->maxSizeInBytes) {
+			auto oldest = this->entries.end();
+			for (auto iterator = this->entries.begin(); iterator != this->entries.end(); ++iterator) {
+				if (iterator->second->readerCount > 0 ||
+					(oldest != this->entries.end() && iterator->second->lastAccess >= oldest->second->lastAccess)) {
+					continue;
+				}
+				std::unique_lock entryLock{ iterator->second->accessMutex };
+				if (iterator->second->isItComplete) {
+					oldest = iterator;
+				}
+			}
+			if (oldest == this->entries.end() || oldest->second->lastAccess == this->accessCounter) {
+				break;
+			}
+			std::error_code errorCode{};
+			std::filesystem::remove(oldest->second->path, errorCode);
+			this->totalSize -= oldest->second->size;
+			this->entries.erase(oldest);
+		}
+	}
+
+}// namespace DiscordCoreInternal
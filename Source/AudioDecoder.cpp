@@ -45,9 +45,9 @@ namespace DiscordCoreInternal {
 		}
 	}
 
-	std::basic_string_view<opus_int16> OpusDecoderWrapper::decodeData(std::basic_string_view<std::byte> dataToDecode) {
+	std::basic_string_view<opus_int16> OpusDecoderWrapper::decodeData(std::basic_string_view<std::byte> dataToDecode, bool decodeFec) {
 		const int64_t sampleCount = opus_decode(this->ptr.get(), reinterpret_cast<const uint8_t*>(dataToDecode.data()),
-			static_cast<opus_int32>(dataToDecode.length() & 0x7FFFFFFF), data.data(), 5760, 0);
+			static_cast<opus_int32>(dataToDecode.length() & 0x7FFFFFFF), data.data(), decodeFec ? 960 : 5760, decodeFec ? 1 : 0);
 		if (sampleCount > 0) {
 			return std::basic_string_view<opus_int16>{ this->data.data(), static_cast<size_t>(sampleCount * 2ull) };
 		} else {
@@ -56,6 +56,42 @@ namespace DiscordCoreInternal {
 		}
 	}
 
+	std::basic_string_view<opus_int16> OpusDecoderWrapper::concealLoss(int32_t sampleCount) {
+		const int64_t sampleCountNew = opus_decode(this->ptr.get(), nullptr, 0, data.data(), sampleCount, 0);
+		if (sampleCountNew > 0) {
+			return std::basic_string_view<opus_int16>{ this->data.data(), static_cast<size_t>(sampleCountNew * 2ull) };
+		} else {
+			throw DiscordCoreAPI::DCAException{ "Failed to conceal a user's lost voice payload, Reason: " +
+				std::string{ opus_strerror(sampleCountNew) } };
+		}
+	}
+
+	void OpusDecoderWrapper::resetState() noexcept {
+		opus_decoder_ctl(this->ptr.get(), OPUS_RESET_STATE);
+	}
+
+	std::unique_ptr<OpusDecoderWrapper> OpusDecoderPool::acquireDecoder() {
+		std::unique_lock lock{ this->accessMutex };
+		if (this->idleDecoders.size() > 0) {
+			std::unique_ptr<OpusDecoderWrapper> decoder{ std::move(this->idleDecoders.back()) };
+			this->idleDecoders.pop_back();
+			return decoder;
+		}
+		lock.unlock();
+		return std::make_unique<OpusDecoderWrapper>();
+	}
+
+	void OpusDecoderPool::releaseDecoder(std::unique_ptr<OpusDecoderWrapper> decoder) noexcept {
+		if (!decoder) {
+			return;
+		}
+		decoder->resetState();
+		std::unique_lock lock{ this->accessMutex };
+		if (this->idleDecoders.size() < maxIdleDecoders) {
+			this->idleDecoders.emplace_back(std::move(decoder));
+		}
+	}
+
 	void AVFrameWrapper::AVFrameDeleter::operator()(AVFrame* other) {
 		if (other) {
 			av_frame_unref(other);
@@ -208,6 +244,7 @@ namespace DiscordCoreInternal {
 	}
 
 	AudioDecoder::AudioDecoder(const BuildAudioDecoderData& dataPackage) {
+		this->doWePassthroughOpus = dataPackage.doWePassthroughOpus;
 		this->configManager = dataPackage.configManager;
 		this->bufferMaxSize = dataPackage.bufferMaxSize;
 		this->totalFileSize = dataPackage.totalFileSize;
@@ -408,6 +445,8 @@ namespace DiscordCoreInternal {
 				this->swrContext = swr_alloc_set_opts(NULL, AV_CH_LAYOUT_STEREO, AVSampleFormat::AV_SAMPLE_FMT_S16, 48000,
 					AV_CH_LAYOUT_STEREO, this->audioDecodeContext->sample_fmt, this->audioDecodeContext->sample_rate, 0, nullptr);
 				swr_init(this->swrContext);
+				this->isItPassthrough = this->doWePassthroughOpus && this->audioStream->codecpar->codec_id == AV_CODEC_ID_OPUS &&
+					this->audioStream->codecpar->sample_rate == 48000 && this->audioStream->codecpar->channels == 2;
 				if (this->configManager->doWePrintFFMPEGSuccessMessages()) {
 					av_dump_format(this->formatContext, 0, "memory", 0);
 				}
@@ -451,6 +490,10 @@ namespace DiscordCoreInternal {
 			}
 
 			while (!token.stop_requested() && !this->areWeQuitting.load() && av_read_frame(this->formatContext, this->packet) == 0) {
+				if (this->packet->stream_index == this->audioStreamIndex && this->isItPassthrough && this->sendEncodedFrame()) {
+					this->packet = av_packet_alloc();
+					continue;
+				}
 				if (this->packet->stream_index == this->audioStreamIndex) {
 					int32_t returnValue = avcodec_send_packet(this->audioDecodeContext, this->packet);
 					if (returnValue < 0) {
@@ -527,6 +570,26 @@ namespace DiscordCoreInternal {
 		return;
 	}
 
+	bool AudioDecoder::sendEncodedFrame() {
+		if (this->packet->size <= 0 || this->packet->size > 1275 ||
+			opus_packet_get_nb_samples(this->packet->data, this->packet->size, 48000) != 960) {
+			this->isItPassthrough = false;
+			if (this->configManager->doWePrintFFMPEGSuccessMessages()) {
+				cout << DiscordCoreAPI::shiftToBrightGreen() << "AudioDecoder::sendEncodedFrame(): falling back to transcoding."
+					 << DiscordCoreAPI::reset() << endl
+					 << endl;
+			}
+			return false;
+		}
+		DiscordCoreAPI::AudioFrameData encodedFrame{};
+		encodedFrame.type = DiscordCoreAPI::AudioFrameType::Encoded;
+		encodedFrame.data.resize(static_cast<uint64_t>(this->packet->size));
+		std::copy(this->packet->data, this->packet->data + this->packet->size, reinterpret_cast<uint8_t*>(encodedFrame.data.data()));
+		encodedFrame.currentSize = this->packet->size;
+		this->outDataBuffer.send(std::move(encodedFrame));
+		return true;
+	}
+
 	void AudioDecoder::cancelMe() {
 		this->refreshTimeForBuffer.store(10);
 		this->inputDataBuffer.clearContents();
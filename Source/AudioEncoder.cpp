@@ -42,10 +42,35 @@ namespace DiscordCoreInternal {
 		if (result != OPUS_OK) {
 			throw DiscordCoreAPI::DCAException{ "Failed to set the Opus signal type, Reason: " + std::string{ opus_strerror(result) } };
 		}
-		result = opus_encoder_ctl(this->ptr.get(), OPUS_SET_BITRATE(OPUS_BITRATE_MAX));
+		this->setOptions(DiscordCoreAPI::OpusEncoderOptions{});
+	}
+
+	void OpusEncoderWrapper::setOptions(const DiscordCoreAPI::OpusEncoderOptions& options) {
+		auto result = opus_encoder_ctl(this->ptr.get(), OPUS_SET_BITRATE(options.bitRate > 0 ? options.bitRate : OPUS_BITRATE_MAX));
 		if (result != OPUS_OK) {
 			throw DiscordCoreAPI::DCAException{ "Failed to set the Opus bitrate, Reason: " + std::string{ opus_strerror(result) } };
 		}
+		result = opus_encoder_ctl(this->ptr.get(), OPUS_SET_VBR(options.enableVbr ? 1 : 0));
+		if (result != OPUS_OK) {
+			throw DiscordCoreAPI::DCAException{ "Failed to set the Opus VBR mode, Reason: " + std::string{ opus_strerror(result) } };
+		}
+		result = opus_encoder_ctl(this->ptr.get(), OPUS_SET_COMPLEXITY(std::clamp(options.complexity, 0, 10)));
+		if (result != OPUS_OK) {
+			throw DiscordCoreAPI::DCAException{ "Failed to set the Opus complexity, Reason: " + std::string{ opus_strerror(result) } };
+		}
+		result = opus_encoder_ctl(this->ptr.get(), OPUS_SET_INBAND_FEC(options.enableFec ? 1 : 0));
+		if (result != OPUS_OK) {
+			throw DiscordCoreAPI::DCAException{ "Failed to set the Opus FEC mode, Reason: " + std::string{ opus_strerror(result) } };
+		}
+		result = opus_encoder_ctl(this->ptr.get(), OPUS_SET_PACKET_LOSS_PERC(std::clamp(options.packetLossPercentage, 0, 100)));
+		if (result != OPUS_OK) {
+			throw DiscordCoreAPI::DCAException{ "Failed to set the Opus packet loss, Reason: " + std::string{ opus_strerror(result) } };
+		}
+		result = opus_encoder_ctl(this->ptr.get(), OPUS_SET_DTX(options.enableDtx ? 1 : 0));
+		if (result != OPUS_OK) {
+			throw DiscordCoreAPI::DCAException{ "Failed to set the Opus DTX mode, Reason: " + std::string{ opus_strerror(result) } };
+		}
+		this->enableDtx = options.enableDtx;
 	}
 
 	EncoderReturnData OpusEncoderWrapper::encodeData(std::basic_string_view<std::byte> inputFrame) {
@@ -63,7 +88,10 @@ namespace DiscordCoreInternal {
 		}
 		EncoderReturnData returnData{};
 		returnData.sampleCount = sampleCount;
-		returnData.data = std::basic_string_view<std::byte>{ this->encodedData.data(), this->encodedData.size() };
+		if (this->enableDtx && count <= 2) {
+			return returnData;
+		}
+		returnData.data = std::basic_string_view<std::byte>{ this->encodedData.data(), static_cast<size_t>(count) };
 		return returnData;
 	}
 }
\ No newline at end of file
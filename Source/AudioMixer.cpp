@@ -0,0 +1,211 @@
+/*
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2021, 2022 Chris M. (RealTimeChris)
+
+	This library is free software; you can redistribute it and/or
+	modify it under the terms of the GNU Lesser General Public
+	License as published by the Free Software Foundation; either
+	version 2.1 of the License, or (at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+	Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public
+	License along with this library; if not, write to the Free Software
+	Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+	USA
+*/
+/// AudioMixer.cpp - Source file for the audio mixer class.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file AudioMixer.cpp
+
+#include <discordcoreapi/AudioMixer.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+	#define DiscordCoreAPI_Mixer_X86
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+	#define DiscordCoreAPI_Mixer_Target(isa) __attribute__((target(isa)))
+#else
+	#define DiscordCoreAPI_Mixer_Target(isa)
+#endif
+
+namespace DiscordCoreInternal {
+
+	AudioMixer::AudioMixer() noexcept {
+		switch (AudioMixer::getInstructionSet()) {
+			case MixerInstructionSet::Avx512: {
+				this->accumulate = &AudioMixer::accumulateAvx512;
+				break;
+			}
+			case MixerInstructionSet::Avx2: {
+				this->accumulate = &AudioMixer::accumulateAvx2;
+				break;
+			}
+			case MixerInstructionSet::Sse41: {
+				this->accumulate = &AudioMixer::accumulateSse41;
+				break;
+			}
+			default: {
+				this->accumulate = &AudioMixer::accumulateScalar;
+				break;
+			}
+		}
+		this->attackCoefficient = 1.0f - std::exp(-4.0f / static_cast<float>(lookaheadFrames));
+		this->releaseCoefficient = 1.0f - std::exp(-1.0f / (0.08f * 48000.0f));
+		this->outputSamples.resize(maxSampleCount);
+		this->accumulator.resize(maxSampleCount);
+		this->delayGains.fill(1.0f);
+	}
+
+	void AudioMixer::beginFrame() noexcept {
+		this->sampleCount = 0;
+	}
+
+	void AudioMixer::addSpeaker(std::basic_string_view<opus_int16> samples, float gain) noexcept {
+		const uint64_t count{ std::min<uint64_t>(samples.size() & ~1ull, maxSampleCount) };
+		if (count > this->sampleCount) {
+			std::fill(this->accumulator.data() + this->sampleCount, this->accumulator.data() + count, 0.0f);
+			this->sampleCount = count;
+		}
+		this->accumulate(this->accumulator.data(), samples.data(), count, gain);
+	}
+
+	std::basic_string_view<opus_int16> AudioMixer::endFrame() noexcept {
+		for (uint64_t x = 0; x < this->sampleCount / 2; ++x) {
+			const float left{ this->accumulator[x * 2] };
+			const float right{ this->accumulator[x * 2 + 1] };
+			const float required{ AudioMixer::getRequiredGain(std::max(std::abs(left), std::abs(right))) };
+			const float delayedLeft{ this->delaySamples[this->delayIndex * 2] };
+			const float delayedRight{ this->delaySamples[this->delayIndex * 2 + 1] };
+			const float evicted{ this->delayGains[this->delayIndex] };
+			this->delaySamples[this->delayIndex * 2] = left;
+			this->delaySamples[this->delayIndex * 2 + 1] = right;
+			this->delayGains[this->delayIndex] = required;
+			this->delayIndex = (this->delayIndex + 1) % lookaheadFrames;
+			if (required <= this->windowMin) {
+				this->windowMin = required;
+			} else if (evicted <= this->windowMin) {
+				this->windowMin = *std::min_element(this->delayGains.begin(), this->delayGains.end());
+			}
+			const float target{ std::min(this->windowMin, evicted) };
+			this->envelope += (target - this->envelope) * (target < this->envelope ? this->attackCoefficient : this->releaseCoefficient);
+			this->envelope = std::min(this->envelope, evicted);
+			this->outputSamples[x * 2] = static_cast<opus_int16>(std::clamp(std::round(delayedLeft * this->envelope), -32768.0f, 32767.0f));
+			this->outputSamples[x * 2 + 1] =
+				static_cast<opus_int16>(std::clamp(std::round(delayedRight * this->envelope), -32768.0f, 32767.0f));
+		}
+		return std::basic_string_view<opus_int16>{ this->outputSamples.data(), this->sampleCount };
+	}
+
+	void AudioMixer::reset() noexcept {
+		this->delaySamples.fill(0.0f);
+		this->delayGains.fill(1.0f);
+		this->windowMin = 1.0f;
+		this->envelope = 1.0f;
+		this->delayIndex = 0;
+	}
+
+	MixerInstructionSet AudioMixer::getInstructionSet() noexcept {
+		static const MixerInstructionSet instructionSet{ AudioMixer::detectInstructionSet() };
+		return instructionSet;
+	}
+
+	MixerInstructionSet AudioMixer::detectInstructionSet() noexcept {
+#if defined(DiscordCoreAPI_Mixer_X86) && defined(_MSC_VER)
+		int32_t registers[4]{};
+		__cpuid(registers, 0);
+		const int32_t maxLeaf{ registers[0] };
+		__cpuid(registers, 1);
+		const bool sse41{ (registers[2] & (1 << 19)) != 0 };
+		const bool osxsave{ (registers[2] & (1 << 27)) != 0 };
+		const uint64_t xcr0{ osxsave ? _xgetbv(0) : 0 };
+		bool avx2{}, avx512{};
+		if (maxLeaf >= 7) {
+			__cpuidex(registers, 7, 0);
+			avx2 = (registers[1] & (1 << 5)) != 0 && (xcr0 & 0x6) == 0x6;
+			avx512 = (registers[1] & (1 << 16)) != 0 && (xcr0 & 0xe6) == 0xe6;
+		}
+		if (avx512) {
+			return MixerInstructionSet::Avx512;
+		} else if (avx2) {
+			return MixerInstructionSet::Avx2;
+		} else if (sse41) {
+			return MixerInstructionSet::Sse41;
+		}
+#elif defined(DiscordCoreAPI_Mixer_X86)
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f")) {
+			return MixerInstructionSet::Avx512;
+		} else if (__builtin_cpu_supports("avx2")) {
+			return MixerInstructionSet::Avx2;
+		} else if (__builtin_cpu_supports("sse4.1")) {
+			return MixerInstructionSet::Sse41;
+		}
+#endif
+		return MixerInstructionSet::Scalar;
+	}
+
+	float AudioMixer::getRequiredGain(float peak) noexcept {
+		if (peak <= kneeStart) {
+			return 1.0f;
+		}
+		const float limited{ kneeStart + (ceiling - kneeStart) * std::tanh((peak - kneeStart) / (ceiling - kneeStart)) };
+		return limited / peak;
+	}
+
+	void AudioMixer::accumulateScalar(float* output, const opus_int16* input, uint64_t count, float gain) noexcept {
+		for (uint64_t x = 0; x < count; ++x) {
+			output[x] += static_cast<float>(input[x]) * gain;
+		}
+	}
+
+	DiscordCoreAPI_Mixer_Target("sse4.1") void AudioMixer::accumulateSse41(float* output, const opus_int16* input, uint64_t count,
+		float gain) noexcept {
+		uint64_t x{};
+#ifdef DiscordCoreAPI_Mixer_X86
+		const __m128 gain128{ _mm_set1_ps(gain) };
+		for (; x + 4 <= count; x += 4) {
+			const __m128 samples{ _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + x)))) };
+			_mm_storeu_ps(output + x, _mm_add_ps(_mm_loadu_ps(output + x), _mm_mul_ps(samples, gain128)));
+		}
+#endif
+		AudioMixer::accumulateScalar(output + x, input + x, count - x, gain);
+	}
+
+	DiscordCoreAPI_Mixer_Target("avx2") void AudioMixer::accumulateAvx2(float* output, const opus_int16* input, uint64_t count,
+		float gain) noexcept {
+		uint64_t x{};
+#ifdef DiscordCoreAPI_Mixer_X86
+		const __m256 gain256{ _mm256_set1_ps(gain) };
+		for (; x + 8 <= count; x += 8) {
+			const __m256 samples{ _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + x)))) };
+			_mm256_storeu_ps(output + x, _mm256_add_ps(_mm256_loadu_ps(output + x), _mm256_mul_ps(samples, gain256)));
+		}
+#endif
+		AudioMixer::accumulateScalar(output + x, input + x, count - x, gain);
+	}
+
+	DiscordCoreAPI_Mixer_Target("avx512f") void AudioMixer::accumulateAvx512(float* output, const opus_int16* input, uint64_t count,
+		float gain) noexcept {
+		uint64_t x{};
+#ifdef DiscordCoreAPI_Mixer_X86
+		const __m512 gain512{ _mm512_set1_ps(gain) };
+		for (; x + 16 <= count; x += 16) {
+			const __m512 samples{ _mm512_cvtepi32_ps(
+				_mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + x)))) };
+			_mm512_storeu_ps(output + x, _mm512_add_ps(_mm512_loadu_ps(output + x), _mm512_mul_ps(samples, gain512)));
+		}
+#endif
+		AudioMixer::accumulateScalar(output + x, input + x, count - x, gain);
+	}
+
+}// namespace DiscordCoreInternal
@@ -0,0 +1,611 @@
+/*
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2021, 2022 Chris M. (RealTimeChris)
+
+	This library is free software; you can redistribute it and/or
+	modify it under the terms of the GNU Lesser General Public
+	License as published by the Free Software Foundation; either
+	version 2.1 of the License, or (at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+	Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public
+	License along with this library; if not, write to the Free Software
+	Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+	USA
+*/
+/// CacheSnapshot.cpp - Source file for the cache snapshot related classes and structs.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file CacheSnapshot.cpp
+
+#include <discordcoreapi/CacheSnapshot.hpp>
+#include <filesystem>
+#include <fstream>
+
+#ifdef _WIN32
+	#include <Windows.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+namespace DiscordCoreAPI {
+
+	void CacheSnapshotWriter::writeString(std::string_view string) {
+		this->writeValue(static_cast<uint32_t>(string.size()));
+		this->buffer.append(string);
+	}
+
+	void CacheSnapshotWriter::writeIds(const std::vector<Snowflake>& ids) {
+		this->writeValue(static_cast<uint32_t>(ids.size()));
+		for (auto& value: ids) {
+			this->writeValue(static_cast<uint64_t>(value));
+		}
+	}
+
+	void CacheSnapshotWriter::beginSection(CacheSnapshotSection type) {
+		this->sectionOffset = this->buffer.size();
+		++this->sectionCount;
+		CacheSnapshotSectionHeader header{};
+		header.type = type;
+		this->writeValue(header);
+	}
+
+	void CacheSnapshotWriter::endSection(uint64_t entryCount) {
+		CacheSnapshotSectionHeader header{};
+		std::memcpy(&header, this->buffer.data() + this->sectionOffset, sizeof(header));
+		header.entryCount = entryCount;
+		header.length = this->buffer.size() - this->sectionOffset - sizeof(header);
+		std::memcpy(this->buffer.data() + this->sectionOffset, &header, sizeof(header));
+	}
+
+	std::string& CacheSnapshotWriter::getBuffer() noexcept {
+		return this->buffer;
+	}
+
+	uint32_t CacheSnapshotWriter::getSectionCount() const noexcept {
+		return this->sectionCount;
+	}
+
+	CacheSnapshotReader::CacheSnapshotReader(std::string_view dataNew) noexcept {
+		this->data = dataNew;
+	}
+
+	std::string_view CacheSnapshotReader::readString() {
+		uint32_t length = this->readValue<uint32_t>();
+		return std::string_view{ this->readBytes(length), length };
+	}
+
+	void CacheSnapshotReader::readIds(std::vector<Snowflake>& ids) {
+		uint32_t count = this->readValue<uint32_t>();
+		if (count > (this->data.size() - this->offset) / sizeof(uint64_t)) {
+			throw DCAException{ "CacheSnapshotReader::readIds() Error: The id list runs past the end of the snapshot." };
+		}
+		ids.clear();
+		ids.reserve(count);
+		for (uint32_t x = 0; x < count; ++x) {
+			ids.emplace_back(this->readValue<uint64_t>());
+		}
+	}
+
+	const char* CacheSnapshotReader::readBytes(uint64_t length) {
+		if (length > this->data.size() - this->offset) {
+			throw DCAException{ "CacheSnapshotReader::readBytes() Error: Attempted to read past the end of the snapshot." };
+		}
+		const char* returnValue = this->data.data() + this->offset;
+		this->offset += length;
+		return returnValue;
+	}
+
+	bool CacheSnapshotReader::isItDone() const noexcept {
+		return this->offset >= this->data.size();
+	}
+
+	MemoryMappedFile::MemoryMappedFile(const std::string& path) noexcept {
+#ifdef _WIN32
+		HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+			return;
+		}
+		this->fileHandle = file;
+		LARGE_INTEGER size{};
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+			return;
+		}
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping) {
+			return;
+		}
+		this->mappingHandle = mapping;
+		this->data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+		if (this->data) {
+			this->length = static_cast<uint64_t>(size.QuadPart);
+		}
+#else
+		int32_t file = open(path.c_str(), O_RDONLY);
+		if (file == -1) {
+			return;
+		}
+		struct stat fileStats {};
+		if (fstat(file, &fileStats) == 0 && fileStats.st_size > 0) {
+			void* mapping = mmap(nullptr, static_cast<size_t>(fileStats.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+			if (mapping != MAP_FAILED) {
+				madvise(mapping, static_cast<size_t>(fileStats.st_size), MADV_SEQUENTIAL);
+				this->data = static_cast<const char*>(mapping);
+				this->length = static_cast<uint64_t>(fileStats.st_size);
+			}
+		}
+		close(file);
+#endif
+	}
+
+	std::string_view MemoryMappedFile::getData() const noexcept {
+		return std::string_view{ this->data, this->length };
+	}
+
+	MemoryMappedFile::~MemoryMappedFile() noexcept {
+#ifdef _WIN32
+		if (this->data) {
+			UnmapViewOfFile(this->data);
+		}
+		if (this->mappingHandle) {
+			CloseHandle(this->mappingHandle);
+		}
+		if (this->fileHandle) {
+			CloseHandle(this->fileHandle);
+		}
+#else
+		if (this->data) {
+			munmap(const_cast<char*>(this->data), this->length);
+		}
+#endif
+	}
+
+	void CacheSnapshots::writeIconHash(CacheSnapshotWriter& writer, const IconHash& icon) {
+		static_assert(std::is_trivially_copyable_v<IconHash>);
+		writer.writeValue(icon);
+	}
+
+	void CacheSnapshots::writeTimeStamp(CacheSnapshotWriter& writer, const TimeStamp& timeStamp) {
+		writer.writeValue(timeStamp.getTimeStampInTimeUnits());
+	}
+
+	void CacheSnapshots::writeGuild(CacheSnapshotWriter& writer, const GuildData& guild) {
+		writer.writeValue(static_cast<uint64_t>(guild.id));
+		writer.writeValue(static_cast<uint64_t>(guild.ownerId));
+		writer.writeValue(guild.memberCount);
+		writer.writeValue(guild.flags);
+		CacheSnapshots::writeTimeStamp(writer, guild.joinedAt);
+		CacheSnapshots::writeIconHash(writer, guild.icon);
+		writer.writeString(static_cast<std::string_view>(guild.name));
+		writer.writeIds(guild.guildScheduledEvents);
+		writer.writeIds(guild.stageInstances);
+		writer.writeIds(guild.stickers);
+		writer.writeIds(guild.channels);
+		writer.writeIds(guild.threads);
+		writer.writeIds(guild.members);
+		writer.writeIds(guild.roles);
+		writer.writeIds(guild.emoji);
+	}
+
+	GuildData CacheSnapshots::readGuild(CacheSnapshotReader& reader) {
+		GuildData guild{};
+		guild.id = reader.readValue<uint64_t>();
+		guild.ownerId = reader.readValue<uint64_t>();
+		guild.memberCount = reader.readValue<uint32_t>();
+		guild.flags = reader.readValue<GuildFlags>();
+		guild.joinedAt = TimeStamp{ reader.readValue<uint64_t>(), TimeFormat::LongDateTime };
+		guild.icon = reader.readValue<IconHash>();
+		guild.name = StringWrapper::intern(reader.readString());
+		reader.readIds(guild.guildScheduledEvents);
+		reader.readIds(guild.stageInstances);
+		reader.readIds(guild.stickers);
+		reader.readIds(guild.channels);
+		reader.readIds(guild.threads);
+		reader.readIds(guild.members);
+		reader.readIds(guild.roles);
+		reader.readIds(guild.emoji);
+		return guild;
+	}
+
+	void CacheSnapshots::writeChannel(CacheSnapshotWriter& writer, const ChannelData& channel) {
+		writer.writeValue(static_cast<uint64_t>(channel.id));
+		writer.writeValue(static_cast<uint64_t>(channel.guildId));
+		writer.writeValue(static_cast<uint64_t>(channel.parentId));
+		writer.writeValue(static_cast<uint64_t>(channel.ownerId));
+		writer.writeValue(channel.defaultSortOrder);
+		writer.writeValue(channel.memberCount);
+		writer.writeValue(channel.position);
+		writer.writeValue(channel.flags);
+		writer.writeValue(channel.type);
+		writer.writeString(static_cast<std::string_view>(channel.name));
+		writer.writeString(static_cast<std::string_view>(channel.topic));
+		writer.writeValue(static_cast<uint32_t>(channel.permissionOverwrites.size()));
+		for (auto& value: channel.permissionOverwrites) {
+			writer.writeValue(static_cast<uint64_t>(value.id));
+			writer.writeValue(value.allow);
+			writer.writeValue(value.deny);
+			writer.writeValue(value.type);
+		}
+	}
+
+	ChannelData CacheSnapshots::readChannel(CacheSnapshotReader& reader) {
+		ChannelData channel{};
+		channel.id = reader.readValue<uint64_t>();
+		channel.guildId = reader.readValue<uint64_t>();
+		channel.parentId = reader.readValue<uint64_t>();
+		channel.ownerId = reader.readValue<uint64_t>();
+		channel.defaultSortOrder = reader.readValue<SortOrderTypes>();
+		channel.memberCount = reader.readValue<uint32_t>();
+		channel.position = reader.readValue<uint16_t>();
+		channel.flags = reader.readValue<ChannelFlags>();
+		channel.type = reader.readValue<ChannelType>();
+		channel.name = StringWrapper::intern(reader.readString());
+		channel.topic = StringWrapper::intern(reader.readString());
+		uint32_t overwriteCount = reader.readValue<uint32_t>();
+		for (uint32_t x = 0; x < overwriteCount; ++x) {
+			OverWriteData overwrite{};
+			overwrite.id = reader.readValue<uint64_t>();
+			overwrite.allow = reader.readValue<uint64_t>();
+			overwrite.deny = reader.readValue<uint64_t>();
+			overwrite.type = reader.readValue<PermissionOverwritesType>();
+			channel.permissionOverwrites.emplace_back(std::move(overwrite));
+		}
+		return channel;
+	}
+
+	void CacheSnapshots::writeRole(CacheSnapshotWriter& writer, const RoleData& role) {
+		ColorValue color{ role.color };
+		writer.writeValue(static_cast<uint64_t>(role.id));
+		writer.writeValue(static_cast<uint64_t>(role.guildId));
+		writer.writeValue(static_cast<uint64_t>(role.permissions));
+		writer.writeValue(color.getIntColorValue());
+		writer.writeValue(role.position);
+		writer.writeValue(role.flags);
+		writer.writeString(static_cast<std::string_view>(role.name));
+		writer.writeString(static_cast<std::string_view>(role.unicodeEmoji));
+	}
+
+	RoleData CacheSnapshots::readRole(CacheSnapshotReader& reader) {
+		RoleData role{};
+		role.id = reader.readValue<uint64_t>();
+		role.guildId = reader.readValue<uint64_t>();
+		role.permissions = reader.readValue<uint64_t>();
+		role.color = ColorValue{ reader.readValue<uint32_t>() };
+		role.position = reader.readValue<int16_t>();
+		role.flags = reader.readValue<RoleFlags>();
+		role.name = StringWrapper::intern(reader.readString());
+		role.unicodeEmoji = reader.readString();
+		return role;
+	}
+
+	void CacheSnapshots::writeUser(CacheSnapshotWriter& writer, const UserData& user) {
+		writer.writeValue(static_cast<uint64_t>(user.id));
+		writer.writeValue(user.flags);
+		CacheSnapshots::writeIconHash(writer, user.avatar);
+		writer.writeString(static_cast<std::string_view>(user.userName));
+		writer.writeString(static_cast<std::string_view>(user.discriminator));
+	}
+
+	UserData CacheSnapshots::readUser(CacheSnapshotReader& reader) {
+		UserData user{};
+		user.id = reader.readValue<uint64_t>();
+		user.flags = reader.readValue<UserFlags>();
+		user.avatar = reader.readValue<IconHash>();
+		user.userName = StringWrapper::intern(reader.readString());
+		user.discriminator = reader.readString();
+		return user;
+	}
+
+	void CacheSnapshots::writeGuildMembers(CacheSnapshotWriter& writer, const GuildMemberColumns& guildMembers) {
+		writer.writeValue(static_cast<uint64_t>(guildMembers.guildId));
+		writer.writeValue(static_cast<uint64_t>(guildMembers.size()));
+		guildMembers.forEach([&](const GuildMemberData& guildMember) {
+			writer.writeValue(static_cast<uint64_t>(guildMember.id));
+			writer.writeValue(static_cast<uint64_t>(guildMember.permissions));
+			writer.writeValue(guildMember.flags);
+			CacheSnapshots::writeTimeStamp(writer, guildMember.joinedAt);
+			CacheSnapshots::writeIconHash(writer, guildMember.avatar);
+			writer.writeString(static_cast<std::string_view>(guildMember.nick));
+			writer.writeIds(guildMember.roles);
+		});
+	}
+
+	GuildMemberColumns CacheSnapshots::readGuildMembers(CacheSnapshotReader& reader) {
+		GuildMemberColumns guildMembers{ reader.readValue<uint64_t>() };
+		uint64_t count = reader.readValue<uint64_t>();
+		GuildMemberData guildMember{};
+		guildMember.guildId = guildMembers.guildId;
+		for (uint64_t x = 0; x < count; ++x) {
+			guildMember.id = reader.readValue<uint64_t>();
+			guildMember.permissions = reader.readValue<uint64_t>();
+			guildMember.flags = reader.readValue<GuildMemberFlags>();
+			guildMember.joinedAt = TimeStamp{ reader.readValue<uint64_t>(), TimeFormat::LongDateTime };
+			guildMember.avatar = reader.readValue<IconHash>();
+			guildMember.nick = reader.readString();
+			reader.readIds(guildMember.roles);
+			guildMembers.insert(guildMember);
+		}
+		return guildMembers;
+	}
+
+	bool CacheSnapshots::save(const std::string& path) {
+		std::unique_lock lock{ CacheSnapshots::saveMutex };
+		CacheSnapshotWriter writer{};
+		writer.writeValue(CacheSnapshotHeader{});
+		uint64_t entryCount{};
+		writer.beginSection(CacheSnapshotSection::Guilds);
+		Guilds::getCache().forEach([&](const GuildData& value) {
+			CacheSnapshots::writeGuild(writer, value);
+			++entryCount;
+		});
+		writer.endSection(std::exchange(entryCount, 0));
+		writer.beginSection(CacheSnapshotSection::Channels);
+		Channels::getCache().forEach([&](const ChannelData& value) {
+			CacheSnapshots::writeChannel(writer, value);
+			++entryCount;
+		});
+		writer.endSection(std::exchange(entryCount, 0));
+		writer.beginSection(CacheSnapshotSection::Roles);
+		Roles::getCache().forEach([&](const RoleData& value) {
+			CacheSnapshots::writeRole(writer, value);
+			++entryCount;
+		});
+		writer.endSection(std::exchange(entryCount, 0));
+		writer.beginSection(CacheSnapshotSection::Users);
+		Users::getCache().forEach([&](const UserData& value) {
+			CacheSnapshots::writeUser(writer, value);
+			++entryCount;
+		});
+		writer.endSection(std::exchange(entryCount, 0));
+		writer.beginSection(CacheSnapshotSection::GuildMembers);
+		GuildMembers::getCache().forEach([&](const GuildMemberColumns& value) {
+			CacheSnapshots::writeGuildMembers(writer, value);
+			++entryCount;
+		});
+		writer.endSection(std::exchange(entryCount, 0));
+
+		auto& buffer = writer.getBuffer();
+		CacheSnapshotHeader header{};
+		header.magic = CacheSnapshots::magic;
+		header.version = CacheSnapshots::version;
+		header.sectionCount = writer.getSectionCount();
+		header.payloadLength = buffer.size() - sizeof(CacheSnapshotHeader);
+		header.checksum = CacheSnapshots::computeChecksum(std::string_view{ buffer }.substr(sizeof(CacheSnapshotHeader)));
+		header.createdAtInMs = std::chrono::duration_cast<Milliseconds>(SysClock::now().time_since_epoch()).count();
+		std::memcpy(buffer.data(), &header, sizeof(header));
+
+		std::string pathNew{ path + ".tmp" };
+		{
+			std::ofstream file{ pathNew, std::ios::binary | std::ios::trunc };
+			if (!file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+				return false;
+			}
+		}
+		std::error_code errorCode{};
+		std::filesystem::rename(pathNew, path, errorCode);
+		return !errorCode;
+	}
+
+	bool CacheSnapshots::load(const std::string& path) {
+		MemoryMappedFile file{ path };
+		std::string_view data = file.getData();
+		if (data.size() < sizeof(CacheSnapshotHeader)) {
+			return false;
+		}
+		CacheSnapshotHeader header{};
+		std::memcpy(&header, data.data(), sizeof(header));
+		data.remove_prefix(sizeof(header));
+		if (header.magic != CacheSnapshots::magic || header.version != CacheSnapshots::version || header.payloadLength != data.size() ||
+			header.checksum != CacheSnapshots::computeChecksum(data)) {
+			return false;
+		}
+		CacheSnapshotReader reader{ data };
+		try {
+			for (uint32_t x = 0; x < header.sectionCount; ++x) {
+				auto sectionHeader = reader.readValue<CacheSnapshotSectionHeader>();
+				CacheSnapshotReader sectionReader{ std::string_view{ reader.readBytes(sectionHeader.length), sectionHeader.length } };
+				CacheSnapshots::loadSection(sectionHeader.type, sectionHeader.entryCount, sectionReader);
+			}
+		} catch (...) {
+			reportException("CacheSnapshots::load()");
+			return false;
+		}
+		return true;
+	}
+
+	void CacheSnapshots::reconcileGuild(const GuildData& guild) {
+		if (getBool(guild.flags, GuildFlags::Unavailable)) {
+			return;
+		}
+		RestoredGuildData restoredGuild{};
+		{
+			std::unique_lock lock{ CacheSnapshots::accessMutex };
+			auto iterator = CacheSnapshots::restoredGuilds.find(static_cast<uint64_t>(guild.id));
+			if (iterator == CacheSnapshots::restoredGuilds.end()) {
+				return;
+			}
+			restoredGuild = std::move(iterator->second);
+			CacheSnapshots::restoredGuilds.erase(iterator);
+		}
+		auto isItPresent = [](const std::vector<Snowflake>& ids, Snowflake id) {
+			return std::find(ids.begin(), ids.end(), id) != ids.end();
+		};
+		if (Channels::doWeCacheChannels()) {
+			for (auto& value: restoredGuild.channels) {
+				if (!isItPresent(guild.channels, value)) {
+					Channels::removeChannel(value);
+					PermissionEngine::removeChannel(guild.id, value);
+				}
+			}
+		}
+		if (Roles::doWeCacheRoles()) {
+			for (auto& value: restoredGuild.roles) {
+				if (!isItPresent(guild.roles, value)) {
+					Roles::removeRole(value);
+					PermissionEngine::removeRole(guild.id, value);
+				}
+			}
+		}
+		if (GuildMembers::doWeCacheGuildMembers() && guild.members.size() >= guild.memberCount) {
+			std::unordered_set<uint64_t> guildMemberIds{};
+			for (auto& value: guild.members) {
+				guildMemberIds.emplace(static_cast<uint64_t>(value));
+			}
+			GuildMembers::getCache().modify(guild.id, [&](GuildMemberColumns& guildMembers) {
+				std::vector<Snowflake> staleIds{};
+				guildMembers.forEachId([&](Snowflake value) {
+					if (!guildMemberIds.contains(static_cast<uint64_t>(value))) {
+						staleIds.emplace_back(value);
+					}
+				});
+				for (auto& value: staleIds) {
+					guildMembers.erase(value);
+				}
+			});
+		}
+	}
+
+	void CacheSnapshots::reconcileReady(uint32_t shard, uint32_t shardCount, const std::vector<Snowflake>& guildIds) {
+		std::unordered_set<uint64_t> readyGuildIds{};
+		for (auto& value: guildIds) {
+			readyGuildIds.emplace(static_cast<uint64_t>(value));
+		}
+		std::vector<std::pair<uint64_t, RestoredGuildData>> leftGuilds{};
+		{
+			std::unique_lock lock{ CacheSnapshots::accessMutex };
+			for (auto iterator = CacheSnapshots::restoredGuilds.begin(); iterator != CacheSnapshots::restoredGuilds.end();) {
+				if ((iterator->first >> 22) % shardCount == shard && !readyGuildIds.contains(iterator->first)) {
+					leftGuilds.emplace_back(iterator->first, std::move(iterator->second));
+					iterator = CacheSnapshots::restoredGuilds.erase(iterator);
+				} else {
+					++iterator;
+				}
+			}
+		}
+		for (auto& [key, value]: leftGuilds) {
+			CacheSnapshots::removeGuild(key, value);
+		}
+	}
+
+	void CacheSnapshots::finishReconciling(uint32_t shard, uint32_t shardCount) {
+		std::unordered_set<uint64_t> userIds{};
+		{
+			std::unique_lock lock{ CacheSnapshots::accessMutex };
+			std::erase_if(CacheSnapshots::restoredGuilds, [&](const auto& value) {
+				return (value.first >> 22) % shardCount == shard;
+			});
+			if (!CacheSnapshots::restoredGuilds.empty() || CacheSnapshots::restoredUsers.empty()) {
+				return;
+			}
+			userIds = std::move(CacheSnapshots::restoredUsers);
+			CacheSnapshots::restoredUsers.clear();
+		}
+		if (!GuildMembers::doWeCacheGuildMembers()) {
+			return;
+		}
+		GuildMembers::getCache().forEach([&](const GuildMemberColumns& value) {
+			value.forEachId([&](Snowflake valueNew) {
+				userIds.erase(static_cast<uint64_t>(valueNew));
+			});
+		});
+		for (auto& value: userIds) {
+			Users::getCache().erase(value);
+		}
+	}
+
+	void CacheSnapshots::removeGuild(Snowflake guildId, const RestoredGuildData& guild) {
+		Guilds::removeGuild(guildId);
+		PermissionEngine::removeGuild(guildId);
+		GuildMembers::getCache().erase(guildId);
+		for (auto& value: guild.channels) {
+			Channels::removeChannel(value);
+		}
+		for (auto& value: guild.roles) {
+			Roles::removeRole(value);
+		}
+	}
+
+	uint64_t CacheSnapshots::computeChecksum(std::string_view data) noexcept {
+		uint64_t returnValue{ data.size() };
+		uint64_t x{};
+		for (; x + sizeof(uint64_t) <= data.size(); x += sizeof(uint64_t)) {
+			uint64_t value{};
+			std::memcpy(&value, data.data() + x, sizeof(uint64_t));
+			returnValue = mixCacheHash(returnValue ^ value);
+		}
+		uint64_t value{};
+		std::memcpy(&value, data.data() + x, data.size() - x);
+		return mixCacheHash(returnValue ^ value);
+	}
+
+	void CacheSnapshots::loadSection(CacheSnapshotSection type, uint64_t entryCount, CacheSnapshotReader& reader) {
+		switch (type) {
+			case CacheSnapshotSection::Guilds: {
+				for (uint64_t x = 0; x < entryCount; ++x) {
+					GuildData guild = CacheSnapshots::readGuild(reader);
+					PermissionEngine::updateOwner(guild.id, guild.ownerId);
+					{
+						std::unique_lock lock{ CacheSnapshots::accessMutex };
+						CacheSnapshots::restoredGuilds.insert_or_assign(static_cast<uint64_t>(guild.id),
+							RestoredGuildData{ .channels = guild.channels, .roles = guild.roles });
+					}
+					Guilds::insertGuild(std::move(guild));
+				}
+				break;
+			}
+			case CacheSnapshotSection::Channels: {
+				for (uint64_t x = 0; x < entryCount; ++x) {
+					ChannelData channel = CacheSnapshots::readChannel(reader);
+					PermissionEngine::updateChannel(channel);
+					Channels::insertChannel(std::move(channel));
+				}
+				break;
+			}
+			case CacheSnapshotSection::Roles: {
+				for (uint64_t x = 0; x < entryCount; ++x) {
+					RoleData role = CacheSnapshots::readRole(reader);
+					PermissionEngine::updateRole(role.guildId, role.id, static_cast<uint64_t>(role.permissions));
+					Roles::insertRole(std::move(role));
+				}
+				break;
+			}
+			case CacheSnapshotSection::Users: {
+				for (uint64_t x = 0; x < entryCount; ++x) {
+					UserData user = CacheSnapshots::readUser(reader);
+					{
+						std::unique_lock lock{ CacheSnapshots::accessMutex };
+						CacheSnapshots::restoredUsers.emplace(static_cast<uint64_t>(user.id));
+					}
+					Users::insertUser(std::move(user));
+				}
+				break;
+			}
+			case CacheSnapshotSection::GuildMembers: {
+				if (!GuildMembers::doWeCacheGuildMembers()) {
+					break;
+				}
+				for (uint64_t x = 0; x < entryCount; ++x) {
+					GuildMembers::getCache().emplace(CacheSnapshots::readGuildMembers(reader));
+				}
+				break;
+			}
+			default: {
+				break;
+			}
+		}
+	}
+
+	std::unordered_map<uint64_t, CacheSnapshots::RestoredGuildData> CacheSnapshots::restoredGuilds{};
+	std::unordered_set<uint64_t> CacheSnapshots::restoredUsers{};
+	std::mutex CacheSnapshots::accessMutex{};
+	std::mutex CacheSnapshots::saveMutex{};
+
+}
@@ -66,9 +66,9 @@ namespace DiscordCoreAPI {
 			}
 		}
 
-		this->name = getString(jsonObjectData, "name");
+		this->name = StringWrapper::intern(getString(jsonObjectData, "name"));
 
-		this->topic = getString(jsonObjectData, "topic");
+		this->topic = StringWrapper::intern(getString(jsonObjectData, "topic"));
 
 		this->permissions = getString(jsonObjectData, "permissions");
 
@@ -294,6 +294,7 @@ namespace DiscordCoreAPI {
 
 	void Channels::initialize(DiscordCoreInternal::HttpsClient* client, ConfigManager* configManagerNew) {
 		Channels::doWeCacheChannelsBool = configManagerNew->doWeCacheChannels();
+		Channels::cache.setPolicy(configManagerNew->getCacheOptions().channelPolicy);
 		Channels::httpsClient = client;
 	}
 
@@ -305,8 +306,8 @@ namespace DiscordCoreAPI {
 		workload.callStack = "Channels::getChannelAsync()";
 		Channel data{};
 		data = Channels::httpsClient->submitWorkloadAndGetResult<Channel>(workload, &data);
-		if (Channels::cache.contains(data)) {
-			data = Channels::cache.at(data);
+		if (auto cachedChannel = Channels::cache.find(data.id)) {
+			data = *cachedChannel;
 		} else {
 			Channels::insertChannel(data);
 		}
@@ -314,16 +315,17 @@ namespace DiscordCoreAPI {
 	}
 
 	ChannelData Channels::getCachedChannel(GetChannelData dataPackage) {
-		ChannelData channel{};
-		channel.id = dataPackage.channelId;
-		if (!Channels::cache.contains(channel)) {
-			return Channels::getChannelAsync(dataPackage).get();
+		if (auto cachedChannel = Channels::cache.find(dataPackage.channelId)) {
+			return *cachedChannel;
 		} else {
-			channel = Channels::cache.at(channel);
-			return channel;
+			return Channels::getChannelAsync(dataPackage).get();
 		}
 	}
 
+	std::shared_ptr<const ChannelData> Channels::getCachedChannelView(GetChannelData dataPackage) {
+		return Channels::cache.find(dataPackage.channelId);
+	}
+
 	CoRoutine<Channel> Channels::modifyChannelAsync(ModifyChannelData dataPackage) {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Patch_Channel };
 		co_await NewThreadAwaitable<Channel>();
@@ -338,8 +340,8 @@ namespace DiscordCoreAPI {
 		}
 		Channel data{};
 		data = Channels::httpsClient->submitWorkloadAndGetResult<Channel>(workload, &data);
-		if (Channels::cache.contains(data)) {
-			data = Channels::cache.at(data);
+		if (auto cachedChannel = Channels::cache.find(data.id)) {
+			data = *cachedChannel;
 		} else {
 			Channels::insertChannel(data);
 		}
@@ -498,16 +500,16 @@ namespace DiscordCoreAPI {
 		co_return Channels::httpsClient->submitWorkloadAndGetResult<VoiceRegionDataVector>(workload, &returnValue);
 	}
 
+	ObjectCache<ChannelData>& Channels::getCache() {
+		return Channels::cache;
+	}
+
 	void Channels::insertChannel(ChannelData channel) {
 		if (channel.id == 0) {
 			return;
 		}
 		if (Channels::doWeCacheChannelsBool) {
-			if (!Channels::cache.contains(channel)) {
-				Channels::cache.emplace(std::move(channel));
-			} else {
-				Channels::cache[channel] = std::move(channel);
-			}
+			Channels::cache.emplace(std::move(channel));
 			if (Channels::cache.size() % 10000 == 0) {
 				std::cout << "CHANNEL COUNT: " << Channels::cache.size() << std::endl;
 			}
@@ -515,9 +517,7 @@ namespace DiscordCoreAPI {
 	}
 
 	void Channels::removeChannel(Snowflake channelId) {
-		ChannelData data{};
-		data.id = channelId;
-		Channels::cache.erase(data);
+		Channels::cache.erase(channelId);
 	};
 
 	bool Channels::doWeCacheChannels() {
@@ -117,6 +117,15 @@ namespace DiscordCoreAPI {
 		}
 	}
 
+	uint64_t getUint64(simdjson::ondemand::value jsonData) {
+		uint64_t value{};
+		if (jsonData.get(value) == simdjson::error_code::SUCCESS) {
+			return value;
+		} else {
+			return 0;
+		}
+	}
+
 	uint32_t getUint32(simdjson::ondemand::value jsonData, const char* key) {
 		uint64_t value{};
 		if (jsonData.type() != simdjson::ondemand::json_type::null) {
@@ -182,6 +191,15 @@ namespace DiscordCoreAPI {
 		}
 	}
 
+	bool getBool(simdjson::ondemand::value jsonData) {
+		bool value{};
+		if (jsonData.get(value) == simdjson::error_code::SUCCESS) {
+			return value;
+		} else {
+			return false;
+		}
+	}
+
 	std::string getString(simdjson::ondemand::value jsonData, const char* key) {
 		std::string_view value{};
 		if (jsonData.type() != simdjson::ondemand::json_type::null) {
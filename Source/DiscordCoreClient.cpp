@@ -35,37 +35,47 @@ namespace DiscordCoreAPI {
 		SoundCloudAPIMap soundCloudAPIMap{};
 		YouTubeAPIMap youtubeAPIMap{};
 		std::atomic_bool doWeQuit{};
+
+		DiscordCoreClient* getDiscordCoreClient(Snowflake guildId) {
+			if (auto guild = Guilds::getCachedGuildView({ .guildId = guildId })) {
+				return guild->discordCoreClient;
+			}
+			return Guilds::getCachedGuild({ .guildId = guildId }).discordCoreClient;
+		}
+	}
+
+	DiscordCoreInternal::AudioCache* DiscordCoreClient::getAudioCache(Snowflake guildId) {
+		return Globals::getDiscordCoreClient(guildId)->audioCache.get();
 	}
 
 	DiscordCoreInternal::SoundCloudAPI* DiscordCoreClient::getSoundCloudAPI(Snowflake guildId) {
-		GuildData guild = Guilds::getCachedGuild({ .guildId = guildId });
 		if (!Globals::soundCloudAPIMap.contains(guildId.operator size_t())) {
+			DiscordCoreClient* discordCoreClient = Globals::getDiscordCoreClient(guildId);
 			Globals::soundCloudAPIMap[guildId.operator size_t()] = std::make_unique<DiscordCoreInternal::SoundCloudAPI>(
-				&guild.discordCoreClient->configManager, guild.discordCoreClient->httpsClient.get(), guildId);
+				&discordCoreClient->configManager, discordCoreClient->httpsClient.get(), guildId);
 		}
 		return Globals::soundCloudAPIMap[guildId.operator size_t()].get();
 	}
 
 	DiscordCoreInternal::YouTubeAPI* DiscordCoreClient::getYouTubeAPI(Snowflake guildId) {
-		GuildData guild = Guilds::getCachedGuild({ .guildId = guildId });
 		if (!Globals::youtubeAPIMap.contains(guildId.operator size_t())) {
+			DiscordCoreClient* discordCoreClient = Globals::getDiscordCoreClient(guildId);
 			Globals::youtubeAPIMap[guildId.operator size_t()] = std::make_unique<DiscordCoreInternal::YouTubeAPI>(
-				&guild.discordCoreClient->configManager, guild.discordCoreClient->httpsClient.get(), guildId);
+				&discordCoreClient->configManager, discordCoreClient->httpsClient.get(), guildId);
 		}
 		return Globals::youtubeAPIMap[guildId.operator size_t()].get();
 	}
 
 	VoiceConnection* DiscordCoreClient::getVoiceConnection(Snowflake guildId) {
-		GuildData guild = Guilds::getCachedGuild({ .guildId = guildId });
 		if (!Globals::voiceConnectionMap.contains(guildId.operator size_t())) {
-			uint64_t theShardId{ (guildId.operator size_t() >> 22) % guild.discordCoreClient->configManager.getTotalShardCount() };
-			uint64_t baseSocketIndex{ theShardId % guild.discordCoreClient->baseSocketAgentsMap.size() };
-			auto baseSocketAgent = guild.discordCoreClient->baseSocketAgentsMap[baseSocketIndex].get();
+			DiscordCoreClient* discordCoreClient = Globals::getDiscordCoreClient(guildId);
+			uint64_t theShardId{ (guildId.operator size_t() >> 22) % discordCoreClient->configManager.getTotalShardCount() };
+			uint64_t baseSocketIndex{ theShardId % discordCoreClient->baseSocketAgentsMap.size() };
+			auto baseSocketAgent = discordCoreClient->baseSocketAgentsMap[baseSocketIndex].get();
 			Globals::voiceConnectionMap[guildId.operator size_t()] =
-				std::make_unique<VoiceConnection>(guild.discordCoreClient, baseSocketAgent->shardMap[theShardId].get(), &Globals::doWeQuit);
+				std::make_unique<VoiceConnection>(discordCoreClient, baseSocketAgent->shardMap[theShardId].get(), &Globals::doWeQuit);
 		}
-		guild.voiceConnectionPtr = Globals::voiceConnectionMap[guildId.operator size_t()].get();
-		return guild.voiceConnectionPtr;
+		return Globals::voiceConnectionMap[guildId.operator size_t()].get();
 	}
 
 	SongAPI* DiscordCoreClient::getSongAPI(Snowflake guildId) {
@@ -150,6 +160,14 @@ namespace DiscordCoreAPI {
 			}
 			return;
 		}
+		StringInterner::setEnabled(this->configManager.getCacheOptions().internStrings);
+		this->guildIngestionPipeline = std::make_unique<DiscordCoreInternal::GuildIngestionPipeline>(this,
+			this->configManager.getCacheOptions().guildIngestionThreadCount);
+		this->voiceEngine = std::make_unique<DiscordCoreInternal::VoiceEngine>(this->configManager.getVoiceOptions().threadCount);
+		if (this->configManager.getVoiceOptions().audioCachePath != "") {
+			this->audioCache = std::make_unique<DiscordCoreInternal::AudioCache>(this->configManager.getVoiceOptions().audioCachePath,
+				this->configManager.getVoiceOptions().audioCacheSizeInBytes);
+		}
 		this->httpsClient = std::make_unique<DiscordCoreInternal::HttpsClient>(&this->configManager);
 		ApplicationCommands::initialize(this->httpsClient.get());
 		AutoModerationRules::initialize(this->httpsClient.get());
@@ -166,6 +184,16 @@ namespace DiscordCoreAPI {
 		Threads::initialize(this->httpsClient.get());
 		Users::initialize(this->httpsClient.get(), &this->configManager);
 		WebHooks::initialize(this->httpsClient.get());
+		std::string snapshotPath{ this->configManager.getCacheOptions().snapshotPath };
+		if (snapshotPath != "") {
+			CacheSnapshots::load(snapshotPath);
+			if (this->configManager.getCacheOptions().snapshotIntervalInMs > 0) {
+				TimeElapsedHandlerNoArgs onSnapshot = [=]() -> void {
+					CacheSnapshots::save(snapshotPath);
+				};
+				ThreadPool::storeThread(onSnapshot, this->configManager.getCacheOptions().snapshotIntervalInMs);
+			}
+		}
 		this->didWeStartCorrectly = true;
 	}
 
@@ -332,12 +360,24 @@ namespace DiscordCoreAPI {
 
 	DiscordCoreClient::~DiscordCoreClient() noexcept {
 		NewThreadAwaiterBase::threadPool.cancelMe();
-		for (auto& value: Guilds::getCache()) {
-			Guild guild = value;
-			if (guild.areWeConnected()) {
-				guild.disconnect();
+		std::vector<Snowflake> guildIds{};
+		Guilds::getCache().forEach([&](const GuildData& value) {
+			guildIds.emplace_back(value.id);
+		});
+		for (auto& value: guildIds) {
+			auto guildView = Guilds::getCachedGuildView({ .guildId = value });
+			if (guildView) {
+				Guild guild = *guildView;
+				if (guild.areWeConnected()) {
+					guild.disconnect();
+				}
 			}
 		}
+		this->baseSocketAgentsMap.clear();
+		this->guildIngestionPipeline.reset();
+		if (this->didWeStartCorrectly && this->configManager.getCacheOptions().snapshotPath != "") {
+			CacheSnapshots::save(this->configManager.getCacheOptions().snapshotPath);
+		}
 	}
 
 	BotUser DiscordCoreClient::currentUser{};
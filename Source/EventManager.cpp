@@ -61,12 +61,11 @@ namespace DiscordCoreAPI {
 
 	OnChannelCreationData::OnChannelCreationData(DiscordCoreInternal::WebSocketMessage& data, simdjson::ondemand::value dataReal) {
 		this->channel = std::make_unique<ChannelData>(data.processJsonMessage<ChannelData>(dataReal, "d"));
+		PermissionEngine::updateChannel(*this->channel);
 		if (Channels::doWeCacheChannels()) {
-			GuildData guild{};
-			guild.id = this->channel->guildId;
-			if (Guilds::getCache().contains(guild)) {
-				Guilds::getCache()[guild].channels.emplace_back(this->channel->id);
-			}
+			Guilds::getCache().modify(this->channel->guildId, [&](GuildData& guild) {
+				guild.channels.emplace_back(this->channel->id);
+			});
 			if (Channels::doWeCacheChannels()) {
 				Channels::insertChannel(*this->channel);
 			}
@@ -84,6 +83,7 @@ namespace DiscordCoreAPI {
 
 	OnChannelUpdateData::OnChannelUpdateData(DiscordCoreInternal::WebSocketMessage& data, simdjson::ondemand::value dataReal) {
 		this->channel = std::make_unique<ChannelData>(data.processJsonMessage<ChannelData>(dataReal, "d"));
+		PermissionEngine::updateChannel(*this->channel);
 		if (Channels::doWeCacheChannels()) {
 			Channels::insertChannel(*this->channel);
 		}
@@ -100,16 +100,15 @@ namespace DiscordCoreAPI {
 
 	OnChannelDeletionData::OnChannelDeletionData(DiscordCoreInternal::WebSocketMessage& data, simdjson::ondemand::value dataReal) {
 		this->channel = std::make_unique<ChannelData>(data.processJsonMessage<ChannelData>(dataReal, "d"));
+		PermissionEngine::removeChannel(this->channel->guildId, this->channel->id);
 		if (Channels::doWeCacheChannels()) {
-			GuildData guild{};
-			guild.id = this->channel->guildId;
-			if (Guilds::getCache().contains(guild)) {
-				for (uint64_t x = 0; x < Guilds::getCache()[guild].channels.size(); ++x) {
-					if (Guilds::getCache()[guild].channels[x] == this->channel->id) {
-						Guilds::getCache()[guild].channels.erase(Guilds::getCache()[guild].channels.begin() + x);
+			Guilds::getCache().modify(this->channel->guildId, [&](GuildData& guild) {
+				for (uint64_t x = 0; x < guild.channels.size(); ++x) {
+					if (guild.channels[x] == this->channel->id) {
+						guild.channels.erase(guild.channels.begin() + x);
 					}
 				}
-			}
+			});
 			if (Channels::doWeCacheChannels()) {
 				Channels::removeChannel(this->channel->id);
 			}
@@ -131,11 +130,9 @@ namespace DiscordCoreAPI {
 
 	OnThreadCreationData::OnThreadCreationData(DiscordCoreInternal::WebSocketMessage& data, simdjson::ondemand::value dataReal) {
 		this->thread = data.processJsonMessage<Thread>(dataReal, "d");
-		GuildData guild{};
-		guild.id = this->thread.guildId;
-		if (Guilds::getCache().contains(guild)) {
-			Guilds::getCache()[guild].threads.emplace_back(this->thread.id);
-		}
+		Guilds::getCache().modify(this->thread.guildId, [&](GuildData& guild) {
+			guild.threads.emplace_back(this->thread.id);
+		});
 	}
 
 	OnThreadUpdateData::OnThreadUpdateData(DiscordCoreInternal::WebSocketMessage& data, simdjson::ondemand::value dataReal) {
@@ -144,15 +141,13 @@ namespace DiscordCoreAPI {
 
 	OnThreadDeletionData::OnThreadDeletionData(DiscordCoreInternal::WebSocketMessage& data, simdjson::ondemand::value dataReal) {
 		this->thread = data.processJsonMessage<Thread>(dataReal, "d");
-		GuildData guild{};
-		guild.id = this->thread.guildId;
-		if (Guilds::getCache().contains(guild)) {
-			for (uint64_t x = 0; x < Guilds::getCache()[guild].threads.size(); ++x) {
-				if (Guilds::getCache()[guild].threads[x] == this->thread.id) {
-					Guilds::getCache()[guild].threads.erase(Guilds::getCache()[guild].threads.begin() + x);
+		Guilds::getCache().modify(this->thread.guildId, [&](GuildData& guild) {
+			for (uint64_t x = 0; x < guild.threads.size(); ++x) {
+				if (guild.threads[x] == this->thread.id) {
+					guild.threads.erase(guild.threads.begin() + x);
 				}
 			}
-		}
+		});
 	}
 
 	OnThreadListSyncData::OnThreadListSyncData(DiscordCoreInternal::WebSocketMessage& data, simdjson::ondemand::value dataReal) {
@@ -171,11 +166,7 @@ namespace DiscordCoreAPI {
 		DiscordCoreClient* client) {
 		this->guild = std::make_unique<GuildData>(data.processJsonMessage<GuildData>(dataReal, "d"));
 		this->guild->discordCoreClient = client;
-		if (Guilds::doWeCacheGuilds()) {
-			if (Guilds::doWeCacheGuilds()) {
-				Guilds::insertGuild(*this->guild);
-			}
-		}
+		Guilds::insertGuild(*this->guild);
 	}
 
 	OnGuildCreationData& OnGuildCreationData::operator=(const OnGuildCreationData& other) {
@@ -211,6 +202,7 @@ namespace DiscordCoreAPI {
 		if (Guilds::doWeCacheGuilds()) {
 			Guilds::removeGuild(this->guild->id);
 		}
+		PermissionEngine::removeGuild(this->guild->id);
 		for (auto& valueNew: this->guild->members) {
 			GuildMemberData guildMember = GuildMembers::getCachedGuildMember({ .guildMemberId = valueNew, .guildId = this->guild->id });
 			GuildMembers::removeGuildMember(guildMember);
@@ -244,26 +236,22 @@ namespace DiscordCoreAPI {
 
 	OnGuildEmojisUpdateData::OnGuildEmojisUpdateData(DiscordCoreInternal::WebSocketMessage& data, simdjson::ondemand::value dataReal) {
 		this->updateData = data.processJsonMessage<GuildEmojisUpdateEventData>(dataReal, "d");
-		GuildData guild{};
-		guild.id = this->updateData.guildId;
-		if (Guilds::getCache().contains(guild)) {
-			Guilds::getCache()[guild].emoji.clear();
+		Guilds::getCache().modify(this->updateData.guildId, [&](GuildData& guild) {
+			guild.emoji.clear();
 			for (auto& valueNew: this->updateData.emojis) {
-				Guilds::getCache()[guild].emoji.emplace_back(valueNew.id);
+				guild.emoji.emplace_back(valueNew.id);
 			}
-		}
+		});
 	}
 
 	OnGuildStickersUpdateData::OnGuildStickersUpdateData(DiscordCoreInternal::WebSocketMessage& data, simdjson::ondemand::value dataReal) {
 		this->updateData = data.processJsonMessage<GuildStickersUpdateEventData>(dataReal, "d");
-		GuildData guild{};
-		guild.id = this->updateData.guildId;
-		if (Guilds::getCache().contains(guild)) {
-			Guilds::getCache()[guild].stickers.clear();
+		Guilds::getCache().modify(this->updateData.guildId, [&](GuildData& guild) {
+			guild.stickers.clear();
 			for (auto& valueNew: this->updateData.stickers) {
-				Guilds::getCache()[guild].stickers.emplace_back(valueNew.id);
+				guild.stickers.emplace_back(valueNew.id);
 			}
-		}
+		});
 	}
 
 	OnGuildIntegrationsUpdateData::OnGuildIntegrationsUpdateData(DiscordCoreInternal::WebSocketMessage& data,
@@ -277,11 +265,9 @@ namespace DiscordCoreAPI {
 		this->discordCoreClient = client;
 		if (GuildMembers::doWeCacheGuildMembers()) {
 			GuildMembers::insertGuildMember(*this->guildMember);
-			GuildData guild{};
-			guild.id = guildMember->guildId;
-			if (Guilds::getCache().contains(guild)) {
-				++Guilds::getCache()[guild].memberCount;
-			}
+			Guilds::getCache().modify(guildMember->guildId, [&](GuildData& guild) {
+				++guild.memberCount;
+			});
 		}
 	}
 
@@ -302,17 +288,15 @@ namespace DiscordCoreAPI {
 		this->user = std::make_unique<UserData>(data.processJsonMessage<UserData>(dataReal["d"], "user"));
 		GuildMember guildMember = GuildMembers::getCachedGuildMember({ .guildMemberId = this->user->id, .guildId = this->guildId });
 		if (GuildMembers::doWeCacheGuildMembers()) {
-			GuildData guild{};
-			guild.id = this->guildId;
 			GuildMembers::removeGuildMember(guildMember);
-			if (Guilds::getCache().contains(guild)) {
-				for (uint64_t x = 0; x < Guilds::getCache()[guild].members.size(); ++x) {
-					if (Guilds::getCache()[guild].members[x] == this->user->id) {
-						--Guilds::getCache()[guild].memberCount;
-						Guilds::getCache()[guild].members.erase(Guilds::getCache()[guild].members.begin() + x);
+			Guilds::getCache().modify(this->guildId, [&](GuildData& guild) {
+				for (uint64_t x = 0; x < guild.members.size(); ++x) {
+					if (guild.members[x] == this->user->id) {
+						--guild.memberCount;
+						guild.members.erase(guild.members.begin() + x);
 					}
 				}
-			}
+			});
 		}
 	}
 
@@ -351,11 +335,10 @@ namespace DiscordCoreAPI {
 	OnRoleCreationData::OnRoleCreationData(DiscordCoreInternal::WebSocketMessage& data, simdjson::ondemand::value dataReal) {
 		this->guildId = getId(dataReal["d"], "guild_id");
 		this->role = std::make_unique<RoleData>(data.processJsonMessage<RoleData>(dataReal["d"], "role"));
-		GuildData guild{};
-		guild.id = guildId;
-		if (Guilds::getCache().contains(guild)) {
-			Guilds::getCache()[guild].roles.emplace_back(this->role->id);
-		}
+		PermissionEngine::updateRole(this->guildId, this->role->id, static_cast<uint64_t>(this->role->permissions));
+		Guilds::getCache().modify(guildId, [&](GuildData& guild) {
+			guild.roles.emplace_back(this->role->id);
+		});
 		if (Roles::doWeCacheRoles()) {
 			Roles::insertRole(*this->role);
 		}
@@ -374,6 +357,7 @@ namespace DiscordCoreAPI {
 	OnRoleUpdateData::OnRoleUpdateData(DiscordCoreInternal::WebSocketMessage& data, simdjson::ondemand::value dataReal) {
 		this->guildId = getId(dataReal["d"], "guild_id");
 		this->role = std::make_unique<RoleData>(data.processJsonMessage<RoleData>(dataReal["d"], "role"));
+		PermissionEngine::updateRole(this->guildId, this->role->id, static_cast<uint64_t>(this->role->permissions));
 		if (Roles::doWeCacheRoles()) {
 			Roles::insertRole(*this->role);
 		}
@@ -393,17 +377,16 @@ namespace DiscordCoreAPI {
 		this->role->id = getId(dataReal["d"], "role_id");
 		this->guildId = getId(dataReal["d"], "guild_id");
 		this->role = std::make_unique<RoleData>(Roles::getCachedRole({ .guildId = this->guildId, .roleId = this->role->id }));
-		GuildData guild{};
-		guild.id = this->guildId;
+		PermissionEngine::removeRole(this->guildId, this->role->id);
 		if (Roles::doWeCacheRoles()) {
 			Roles::removeRole(this->role->id);
-			if (Guilds::getCache().contains(guild)) {
-				for (uint64_t x = 0; x < Guilds::getCache()[guild].roles.size(); ++x) {
-					if (Guilds::getCache()[guild].roles[x] == this->role->id) {
-						Guilds::getCache()[guild].roles.erase(Guilds::getCache()[guild].roles.begin() + x);
+			Guilds::getCache().modify(this->guildId, [&](GuildData& guild) {
+				for (uint64_t x = 0; x < guild.roles.size(); ++x) {
+					if (guild.roles[x] == this->role->id) {
+						guild.roles.erase(guild.roles.begin() + x);
 					}
 				}
-			}
+			});
 		}
 	}
 
@@ -449,11 +432,9 @@ namespace DiscordCoreAPI {
 	OnGuildScheduledEventCreationData::OnGuildScheduledEventCreationData(DiscordCoreInternal::WebSocketMessage& data,
 		simdjson::ondemand::value dataReal) {
 		this->guildScheduledEvent = data.processJsonMessage<GuildScheduledEventData>(dataReal, "d");
-		GuildData guild{};
-		guild.id = this->guildScheduledEvent.guildId;
-		if (Guilds::getCache().contains(guild)) {
-			Guilds::getCache()[guild].guildScheduledEvents.emplace_back(this->guildScheduledEvent.id);
-		}
+		Guilds::getCache().modify(this->guildScheduledEvent.guildId, [&](GuildData& guild) {
+			guild.guildScheduledEvents.emplace_back(this->guildScheduledEvent.id);
+		});
 	}
 
 	OnGuildScheduledEventUpdateData::OnGuildScheduledEventUpdateData(DiscordCoreInternal::WebSocketMessage& data,
@@ -464,15 +445,13 @@ namespace DiscordCoreAPI {
 	OnGuildScheduledEventDeletionData::OnGuildScheduledEventDeletionData(DiscordCoreInternal::WebSocketMessage& data,
 		simdjson::ondemand::value dataReal) {
 		this->guildScheduledEvent = data.processJsonMessage<GuildScheduledEventData>(dataReal, "d");
-		GuildData guild{};
-		guild.id = this->guildScheduledEvent.guildId;
-		if (Guilds::getCache().contains(guild)) {
-			for (uint64_t x = 0; x < Guilds::getCache()[guild].guildScheduledEvents.size(); ++x) {
-				if (Guilds::getCache()[guild].guildScheduledEvents[x] == this->guildScheduledEvent.id) {
-					Guilds::getCache()[guild].guildScheduledEvents.erase(Guilds::getCache()[guild].guildScheduledEvents.begin() + x);
+		Guilds::getCache().modify(this->guildScheduledEvent.guildId, [&](GuildData& guild) {
+			for (uint64_t x = 0; x < guild.guildScheduledEvents.size(); ++x) {
+				if (guild.guildScheduledEvents[x] == this->guildScheduledEvent.id) {
+					guild.guildScheduledEvents.erase(guild.guildScheduledEvents.begin() + x);
 				}
 			}
-		}
+		});
 	}
 
 	OnGuildScheduledEventUserAddData::OnGuildScheduledEventUserAddData(DiscordCoreInternal::WebSocketMessage& data,
@@ -652,11 +631,9 @@ namespace DiscordCoreAPI {
 	OnStageInstanceCreationData::OnStageInstanceCreationData(DiscordCoreInternal::WebSocketMessage& data,
 		simdjson::ondemand::value dataReal) {
 		this->stageInstance = data.processJsonMessage<StageInstance>(dataReal, "d");
-		GuildData guild{};
-		guild.id = this->stageInstance.guildId;
-		if (Guilds::getCache().contains(guild)) {
-			Guilds::getCache()[guild].stageInstances.emplace_back(this->stageInstance.id);
-		}
+		Guilds::getCache().modify(this->stageInstance.guildId, [&](GuildData& guild) {
+			guild.stageInstances.emplace_back(this->stageInstance.id);
+		});
 	}
 
 	OnStageInstanceUpdateData::OnStageInstanceUpdateData(DiscordCoreInternal::WebSocketMessage& data, simdjson::ondemand::value dataReal) {
@@ -666,15 +643,13 @@ namespace DiscordCoreAPI {
 	OnStageInstanceDeletionData::OnStageInstanceDeletionData(DiscordCoreInternal::WebSocketMessage& data,
 		simdjson::ondemand::value dataReal) {
 		this->stageInstance = data.processJsonMessage<StageInstance>(dataReal, "d");
-		GuildData guild{};
-		guild.id = this->stageInstance.guildId;
-		if (Guilds::getCache().contains(guild)) {
-			for (uint64_t x = 0; x < Guilds::getCache()[guild].stageInstances.size(); ++x) {
-				if (Guilds::getCache()[guild].stageInstances[x] == this->stageInstance.id) {
-					Guilds::getCache()[guild].stageInstances.erase(Guilds::getCache()[guild].stageInstances.begin() + x);
+		Guilds::getCache().modify(this->stageInstance.guildId, [&](GuildData& guild) {
+			for (uint64_t x = 0; x < guild.stageInstances.size(); ++x) {
+				if (guild.stageInstances[x] == this->stageInstance.id) {
+					guild.stageInstances.erase(guild.stageInstances.begin() + x);
 				}
 			}
-		}
+		});
 	}
 
 	OnTypingStartData::OnTypingStartData(DiscordCoreInternal::WebSocketMessage& data, simdjson::ondemand::value dataReal) {
@@ -691,21 +666,8 @@ namespace DiscordCoreAPI {
 	OnVoiceStateUpdateData::OnVoiceStateUpdateData(DiscordCoreInternal::WebSocketMessage& data, simdjson::ondemand::value dataReal,
 		DiscordCoreInternal::WebSocketClient* sslShard) {
 		this->voiceStateData = data.processJsonMessage<VoiceStateData>(dataReal, "d");
-		sslShard->voiceConnectionData.sessionId = this->voiceStateData.sessionId;
-		if (sslShard->areWeCollectingData && !sslShard->stateUpdateCollected && !sslShard->serverUpdateCollected &&
-			this->voiceStateData.userId == sslShard->userId) {
-			sslShard->voiceConnectionData = DiscordCoreInternal::VoiceConnectionData{};
-			sslShard->voiceConnectionData.sessionId = this->voiceStateData.sessionId;
-			sslShard->stateUpdateCollected = true;
-		} else if (sslShard->areWeCollectingData && !sslShard->stateUpdateCollected) {
-			sslShard->voiceConnectionData.sessionId = this->voiceStateData.sessionId;
-			if (sslShard->voiceConnectionDataBuffersMap.contains(this->voiceStateData.guildId.operator size_t())) {
-				sslShard->voiceConnectionDataBuffersMap[this->voiceStateData.guildId.operator size_t()]->send(
-					sslShard->voiceConnectionData);
-			}
-			sslShard->serverUpdateCollected = false;
-			sslShard->stateUpdateCollected = false;
-			sslShard->areWeCollectingData = false;
+		if (sslShard) {
+			sslShard->collectVoiceState(this->voiceStateData);
 		}
 		GuildMembers::insertVoiceState(this->voiceStateData);
 	}
@@ -1259,4 +1221,13 @@ namespace DiscordCoreAPI {
 		onWebhookUpdateEvent.remove(token);
 	}
 
+	DiscordCoreInternal::EventDelegateToken EventManager::onGuildsReady(
+		DiscordCoreInternal::EventDelegate<CoRoutine<void>, OnGuildsReadyData> handler) {
+		return this->onGuildsReadyEvent.add(std::move(handler));
+	}
+
+	void EventManager::onGuildsReady(DiscordCoreInternal::EventDelegateToken& token) {
+		onGuildsReadyEvent.remove(token);
+	}
+
 };
\ No newline at end of file
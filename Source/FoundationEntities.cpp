@@ -142,6 +142,8 @@ namespace DiscordCoreInternal {
 			this->callStack = std::move(other.callStack);
 			this->workloadClass = other.workloadClass;
 			this->baseUrl = std::move(other.baseUrl);
+			this->bodySources = std::move(other.bodySources);
+			this->multiPartSummary = std::move(other.multiPartSummary);
 			this->content = std::move(other.content);
 			this->workloadType = other.workloadType;
 			this->payloadType = other.payloadType;
@@ -171,6 +173,210 @@ namespace DiscordCoreInternal {
 		return value;
 	}
 
+	void HttpsWorkloadData::setMultiPartContent(std::string payloadJson, const std::vector<DiscordCoreAPI::File>& files) {
+		const std::string boundary("boundary25");
+		const std::string partStart("--" + boundary + "\r\nContent-Type: application/octet-stream\r\nContent-Disposition: form-data; ");
+		this->multiPartSummary = "Multipart-form, boundary: " + boundary + ", payload_json: " + payloadJson;
+		std::string currentPart("--" + boundary);
+		currentPart += "\r\nContent-Type: application/json\r\nContent-Disposition: form-data; "
+					   "name=\"payload_json\"\r\n\r\n";
+		currentPart += payloadJson + "\r\n";
+		this->bodySources.clear();
+		for (uint64_t x = 0; x < files.size(); ++x) {
+			std::string partName{ files.size() == 1 ? "file" : "files[" + std::to_string(x) + "]" };
+			currentPart += partStart + "name=\"" + partName + "\"; filename=\"" + files[x].fileName + "\"\r\n\r\n";
+			this->bodySources.emplace_back(std::make_unique<HttpsStringBodySource>(std::move(currentPart)));
+			if (files[x].filePath != "") {
+				this->bodySources.emplace_back(std::make_unique<HttpsMappedFileBodySource>(files[x].filePath));
+			} else {
+				this->bodySources.emplace_back(std::make_unique<HttpsStringBodySource>(std::string_view{ files[x].data }));
+			}
+			this->multiPartSummary += ", " + partName + ": " + files[x].fileName + " (" + std::to_string(this->bodySources.back()->size()) +
+				" bytes)";
+			currentPart = files.size() == 1 ? "" : "\r\n";
+		}
+		currentPart += "\r\n--" + boundary + "--";
+		this->bodySources.emplace_back(std::make_unique<HttpsStringBodySource>(std::move(currentPart)));
+		this->content.clear();
+	}
+
+	uint64_t HttpsWorkloadData::getBodySize() const {
+		uint64_t returnValue{};
+		for (auto& value: this->bodySources) {
+			returnValue += value->size();
+		}
+		return returnValue;
+	}
+
+	std::string HttpsWorkloadData::getContentSummary() const {
+		if (this->bodySources.size() > 0) {
+			return this->multiPartSummary;
+		}
+		return this->content;
+	}
+
+	HttpsStringBodySource::HttpsStringBodySource(std::string&& dataNew) {
+		this->data = std::move(dataNew);
+		this->dataView = this->data;
+	}
+
+	HttpsStringBodySource::HttpsStringBodySource(std::string_view dataNew) {
+		this->dataView = dataNew;
+	}
+
+	std::string_view HttpsStringBodySource::readData() {
+		if (this->haveWeRead) {
+			return std::string_view{};
+		}
+		this->haveWeRead = true;
+		return this->dataView;
+	}
+
+	void HttpsStringBodySource::rewind() {
+		this->haveWeRead = false;
+	}
+
+	uint64_t HttpsStringBodySource::size() {
+		return this->dataView.size();
+	}
+
+	HttpsFileBodySource::HttpsFileBodySource(int32_t fileDescriptorNew, uint64_t sizeNew) {
+		this->fileDescriptor = fileDescriptorNew;
+		this->bytesRemaining = sizeNew;
+		this->totalSize = sizeNew;
+		this->buffer.resize(1024 * 16);
+#ifdef _WIN32
+		this->startOffset = _lseeki64(this->fileDescriptor, 0, SEEK_CUR);
+#else
+		this->startOffset = lseek(this->fileDescriptor, 0, SEEK_CUR);
+#endif
+	}
+
+	std::string_view HttpsFileBodySource::readData() {
+		if (this->bytesRemaining == 0) {
+			return std::string_view{};
+		}
+		uint64_t bytesToRead{ std::min(this->bytesRemaining, static_cast<uint64_t>(this->buffer.size())) };
+#ifdef _WIN32
+		auto bytesRead = _read(this->fileDescriptor, this->buffer.data(), static_cast<uint32_t>(bytesToRead));
+#else
+		auto bytesRead = read(this->fileDescriptor, this->buffer.data(), bytesToRead);
+#endif
+		if (bytesRead <= 0) {
+			this->bytesRemaining = 0;
+			return std::string_view{};
+		}
+		this->bytesRemaining -= static_cast<uint64_t>(bytesRead);
+		return std::string_view{ this->buffer.data(), static_cast<uint64_t>(bytesRead) };
+	}
+
+	void HttpsFileBodySource::rewind() {
+#ifdef _WIN32
+		_lseeki64(this->fileDescriptor, this->startOffset, SEEK_SET);
+#else
+		lseek(this->fileDescriptor, this->startOffset, SEEK_SET);
+#endif
+		this->bytesRemaining = this->totalSize;
+	}
+
+	uint64_t HttpsFileBodySource::size() {
+		return this->totalSize;
+	}
+
+	HttpsMappedFileBodySource::HttpsMappedFileBodySource(const std::string& filePath) {
+#ifdef _WIN32
+		this->fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		LARGE_INTEGER fileSize{};
+		if (this->fileHandle == INVALID_HANDLE_VALUE || !GetFileSizeEx(this->fileHandle, &fileSize)) {
+			throw DiscordCoreAPI::DCAException{ "Failed to open the file: " + filePath };
+		}
+		if (fileSize.QuadPart > 0) {
+			this->mappingHandle = CreateFileMappingA(this->fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			void* address{ this->mappingHandle ? MapViewOfFile(this->mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr };
+			if (!address) {
+				throw DiscordCoreAPI::DCAException{ "Failed to map the file: " + filePath };
+			}
+			this->mappedData = std::string_view{ static_cast<const char*>(address), static_cast<uint64_t>(fileSize.QuadPart) };
+		}
+#else
+		auto fileDescriptor = open(filePath.c_str(), O_RDONLY);
+		struct stat fileStats {};
+		if (fileDescriptor == -1 || fstat(fileDescriptor, &fileStats) == -1) {
+			if (fileDescriptor != -1) {
+				close(fileDescriptor);
+			}
+			throw DiscordCoreAPI::DCAException{ "Failed to open the file: " + filePath };
+		}
+		if (fileStats.st_size > 0) {
+			void* address{ mmap(nullptr, static_cast<uint64_t>(fileStats.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0) };
+			close(fileDescriptor);
+			if (address == MAP_FAILED) {
+				throw DiscordCoreAPI::DCAException{ "Failed to map the file: " + filePath };
+			}
+			madvise(address, static_cast<uint64_t>(fileStats.st_size), MADV_SEQUENTIAL);
+			this->mappedData = std::string_view{ static_cast<const char*>(address), static_cast<uint64_t>(fileStats.st_size) };
+		} else {
+			close(fileDescriptor);
+		}
+#endif
+	}
+
+	std::string_view HttpsMappedFileBodySource::readData() {
+		uint64_t bytesToRead{ std::min(this->mappedData.size() - this->currentOffset, static_cast<uint64_t>(1024 * 256)) };
+		std::string_view returnValue{ this->mappedData.substr(this->currentOffset, bytesToRead) };
+		this->currentOffset += bytesToRead;
+		return returnValue;
+	}
+
+	void HttpsMappedFileBodySource::rewind() {
+		this->currentOffset = 0;
+	}
+
+	uint64_t HttpsMappedFileBodySource::size() {
+		return this->mappedData.size();
+	}
+
+	HttpsMappedFileBodySource::~HttpsMappedFileBodySource() noexcept {
+#ifdef _WIN32
+		if (this->mappedData.data()) {
+			UnmapViewOfFile(this->mappedData.data());
+		}
+		if (this->mappingHandle) {
+			CloseHandle(this->mappingHandle);
+		}
+		if (this->fileHandle != INVALID_HANDLE_VALUE) {
+			CloseHandle(this->fileHandle);
+		}
+#else
+		if (this->mappedData.data()) {
+			munmap(const_cast<char*>(this->mappedData.data()), this->mappedData.size());
+		}
+#endif
+	}
+
+	HttpsGeneratorBodySource::HttpsGeneratorBodySource(std::function<std::string_view(uint64_t)> generatorNew, uint64_t sizeNew) {
+		this->generator = std::move(generatorNew);
+		this->totalSize = sizeNew;
+	}
+
+	std::string_view HttpsGeneratorBodySource::readData() {
+		if (this->currentOffset >= this->totalSize || !this->generator) {
+			return std::string_view{};
+		}
+		std::string_view returnValue{ this->generator(this->currentOffset) };
+		returnValue = returnValue.substr(0, std::min(static_cast<uint64_t>(returnValue.size()), this->totalSize - this->currentOffset));
+		this->currentOffset += returnValue.size();
+		return returnValue;
+	}
+
+	void HttpsGeneratorBodySource::rewind() {
+		this->currentOffset = 0;
+	}
+
+	uint64_t HttpsGeneratorBodySource::size() {
+		return this->totalSize;
+	}
+
 	std::unordered_map<HttpsWorkloadType, std::unique_ptr<std::atomic_int64_t>> HttpsWorkloadData::workloadIdsExternal{};
 	std::unordered_map<HttpsWorkloadType, std::unique_ptr<std::atomic_int64_t>> HttpsWorkloadData::workloadIdsInternal{};
 
@@ -203,6 +409,13 @@ namespace DiscordCoreInternal {
 		if (jsonObjectData["user"].get(user) == simdjson::error_code::SUCCESS) {
 			this->user = DiscordCoreAPI::UserData{ user };
 		}
+
+		simdjson::ondemand::array arrayValue{};
+		if (DiscordCoreAPI::getArray(arrayValue, "guilds", jsonObjectData)) {
+			for (simdjson::simdjson_result<simdjson::ondemand::value> value: arrayValue) {
+				this->guilds.emplace_back(DiscordCoreAPI::getId(value.value(), "id"));
+			}
+		}
 	}
 }
 
@@ -281,7 +494,7 @@ namespace DiscordCoreAPI {
 
 		this->flags = static_cast<UserFlags>(newFlags);
 
-		this->userName = getString(jsonObjectData, "username");
+		this->userName = StringWrapper::intern(getString(jsonObjectData, "username"));
 
 		this->avatar = getString(jsonObjectData, "avatar");
 
@@ -513,7 +726,7 @@ namespace DiscordCoreAPI {
 	RoleData::RoleData(simdjson::ondemand::value jsonObjectData) {
 		this->id = getId(jsonObjectData, "id");
 
-		this->name = getString(jsonObjectData, "name");
+		this->name = StringWrapper::intern(getString(jsonObjectData, "name"));
 
 		std::stringstream stream{};
 		stream << getString(jsonObjectData, "unicode_emoji");
@@ -545,7 +758,7 @@ namespace DiscordCoreAPI {
 	EmojiData::EmojiData(simdjson::ondemand::value jsonObjectData) {
 		this->id = getId(jsonObjectData, "id");
 
-		this->name = getString(jsonObjectData, "name");
+		this->name = StringWrapper::intern(getString(jsonObjectData, "name"));
 
 		simdjson::ondemand::array arrayValue{};
 		if (getArray(arrayValue, "roles", jsonObjectData)) {
@@ -639,7 +852,7 @@ namespace DiscordCoreAPI {
 
 		this->flags = static_cast<GuildMemberFlags>(newFlags);
 
-		this->nick = getString(jsonObjectData, "nick");
+		this->nick = StringWrapper::intern(getString(jsonObjectData, "nick"));
 		return *this;
 	}
 
@@ -648,12 +861,12 @@ namespace DiscordCoreAPI {
 	}
 
 	VoiceStateDataLight GuildMemberData::getVoiceStateData() {
-		VoiceStateDataLight dataToGet{};
-		dataToGet.guildId = this->guildId;
-		dataToGet.userId = this->id;
-		if (GuildMembers::getVsCache().contains(dataToGet)) {
-			return GuildMembers::getVsCache()[dataToGet];
+		if (auto voiceState = GuildMembers::getVsCache().find(GuildScopedKey{ this->guildId, this->id })) {
+			return *voiceState;
 		} else {
+			VoiceStateDataLight dataToGet{};
+			dataToGet.guildId = this->guildId;
+			dataToGet.userId = this->id;
 			return dataToGet;
 		}
 	}
@@ -737,7 +950,7 @@ namespace DiscordCoreAPI {
 			}
 		}
 
-		this->name = getString(jsonObjectData, "name");
+		this->name = StringWrapper::intern(getString(jsonObjectData, "name"));
 	}
 
 	ActiveThreadsData::ActiveThreadsData(simdjson::ondemand::value jsonObjectData) {
@@ -1336,19 +1549,16 @@ namespace DiscordCoreAPI {
 	}
 
 	VoiceConnection* GuildData::connectToVoice(const Snowflake guildMemberId, const Snowflake channelId, bool selfDeaf, bool selfMute,
-		StreamInfo streamInfoNew) {
+		StreamInfo streamInfoNew, OpusEncoderOptions encoderOptions) {
 		if (DiscordCoreClient::getVoiceConnection(this->id) && DiscordCoreClient::getVoiceConnection(this->id)->areWeConnected()) {
 			this->voiceConnectionPtr = DiscordCoreClient::getVoiceConnection(this->id);
 			return this->voiceConnectionPtr;
 		} else if (static_cast<Snowflake>(guildMemberId) != 0 || static_cast<Snowflake>(channelId) != 0) {
 			Snowflake channelId{};
 			if (static_cast<Snowflake>(guildMemberId) != 0) {
-				VoiceStateDataLight dataLight{};
-				dataLight.guildId = this->id;
-				dataLight.userId = guildMemberId;
-				auto voiceStateData = GuildMembers::getVsCache()[dataLight];
-				if (voiceStateData.channelId != 0) {
-					channelId = voiceStateData.channelId;
+				auto voiceStateData = GuildMembers::getVsCache().find(GuildScopedKey{ this->id, guildMemberId });
+				if (voiceStateData && voiceStateData->channelId != 0) {
+					channelId = voiceStateData->channelId;
 				}
 			} else {
 				channelId = channelId;
@@ -1360,6 +1570,7 @@ namespace DiscordCoreAPI {
 			VoiceConnectInitData voiceConnectInitData{};
 			voiceConnectInitData.currentShard = theShardId;
 			voiceConnectInitData.streamInfo = streamInfoNew;
+			voiceConnectInitData.encoderOptions = encoderOptions;
 			voiceConnectInitData.channelId = channelId;
 			voiceConnectInitData.guildId = this->id;
 			voiceConnectInitData.userId = this->discordCoreClient->getBotUser().id;
@@ -1402,123 +1613,124 @@ namespace DiscordCoreAPI {
 	}
 
 	GuildData::GuildData(simdjson::ondemand::value jsonObjectData) {
-		uint8_t newFlags{};
-		newFlags = setBool(newFlags, GuildFlags::WidgetEnabled, getBool(jsonObjectData, "widget_enabled"));
-
-		newFlags = setBool(newFlags, GuildFlags::Unavailable, getBool(jsonObjectData, "unavailable"));
-
-		newFlags = setBool(newFlags, GuildFlags::Owner, getBool(jsonObjectData, "owner"));
-
-		newFlags = setBool(newFlags, GuildFlags::Large, getUint8(jsonObjectData, "large"));
-
-		this->flags = static_cast<GuildFlags>(newFlags);
-
-		this->ownerId = getId(jsonObjectData, "owner_id");
-
-		this->memberCount = getUint32(jsonObjectData, "member_count");
-
-		this->joinedAt = getString(jsonObjectData, "joined_at");
-
-		this->id = getId(jsonObjectData, "id");
-
-		this->icon = getString(jsonObjectData, "icon");
-
-		this->name = getString(jsonObjectData, "name");
-
-		this->threads.clear();
-
-		simdjson::ondemand::array arrayValue{};
-		if (getArray(arrayValue, "features", jsonObjectData)) {
-			this->threads.clear();
-			for (auto value: arrayValue) {
-				auto& object = value.value();
-				this->threads.emplace_back(getId(object, "id"));
-			}
-		}
-
-		if (getArray(arrayValue, "stickers", jsonObjectData)) {
-			this->stickers.clear();
-			for (auto value: arrayValue) {
-				this->stickers.emplace_back(getId(value.value(), "id"));
-			}
-		}
-
-		if (getArray(arrayValue, "guild_scheduled_events", jsonObjectData)) {
-			this->guildScheduledEvents.clear();
-			for (auto value: arrayValue) {
-				this->guildScheduledEvents.emplace_back(getId(value.value(), "id"));
-			}
+		simdjson::ondemand::object object{};
+		if (jsonObjectData.get(object) != simdjson::error_code::SUCCESS) {
+			return;
 		}
 
-		if (getArray(arrayValue, "stage_instances", jsonObjectData)) {
-			this->stageInstances.clear();
-			for (auto value: arrayValue) {
-				this->stageInstances.emplace_back(getId(value.value(), "id"));
-			}
+		simdjson::ondemand::value idValue{};
+		if (object["id"].get(idValue) == simdjson::error_code::SUCCESS) {
+			this->id = getId(idValue);
 		}
-
-		if (getArray(arrayValue, "emoji", jsonObjectData)) {
-			this->emoji.clear();
-			for (auto value: arrayValue) {
-				this->emoji.emplace_back(getId(value.value(), "id"));
-			}
+		if (object.reset().error() != simdjson::error_code::SUCCESS) {
+			return;
 		}
 
-		if (Roles::doWeCacheRoles()) {
-			this->roles.clear();
-			if (getArray(arrayValue, "roles", jsonObjectData)) {
-				for (auto value: arrayValue) {
-					RoleData newData{ value.value() };
-					newData.guildId = this->id;
-					this->roles.emplace_back(newData.id);
-					Roles::insertRole(std::move(newData));
+		/// Walks the Guild's fields once, in the order that they arrive, handing each member, Role, Channel and voice state to its cache
+		/// as it is reached, rather than seeking for each key in turn across the (potentially very large) member and presence arrays.
+		/// Presences are the one array that is kept on the GuildData itself: there is no presence cache to hand them to, and they are
+		/// what Guild::presences is built from. They are counted in the Guild's cache footprint, so CacheOptions::guildPolicy's maxBytes
+		/// bounds them.
+		uint8_t newFlags{};
+		simdjson::ondemand::array arrayValue{};
+		auto collectIds = [&arrayValue](std::vector<Snowflake>& ids, simdjson::ondemand::value value) {
+			if (getArray(arrayValue, value)) {
+				ids.clear();
+				for (auto entity: arrayValue) {
+					ids.emplace_back(getId(entity.value(), "id"));
 				}
 			}
-		}
-
-		if (GuildMembers::doWeCacheGuildMembers()) {
-			this->members.clear();
-			GuildMemberData newData{};
-			if (getArray(arrayValue, "members", jsonObjectData)) {
-				for (auto value: arrayValue) {
-					newData = value.value();
-					newData.guildId = this->id;
-					this->members.emplace_back(newData.id);
-					GuildMembers::insertGuildMember(std::move(newData));
+		};
+		for (auto field: object) {
+			std::string_view key{};
+			simdjson::ondemand::value value{};
+			if (field.unescaped_key().get(key) != simdjson::error_code::SUCCESS ||
+				field.value().get(value) != simdjson::error_code::SUCCESS) {
+				continue;
+			}
+			if (key == "members") {
+				if (GuildMembers::doWeCacheGuildMembers() && getArray(arrayValue, value)) {
+					this->members.clear();
+					GuildMemberData newData{};
+					for (auto member: arrayValue) {
+						newData = member.value();
+						newData.guildId = this->id;
+						this->members.emplace_back(newData.id);
+						GuildMembers::insertGuildMember(std::move(newData));
+					}
 				}
-			}
-		}
-
-		if (getArray(arrayValue, "voice_states", jsonObjectData)) {
-			for (auto value: arrayValue) {
-				VoiceStateDataLight dataNew{ value.value() };
-				dataNew.guildId = this->id;
-				GuildMembers::vsCache[dataNew] = dataNew;
-			}
-		}
-
-		if (GuildMembers::doWeCacheGuildMembers()) {
-			this->presences.clear();
-			if (getArray(arrayValue, "presences", jsonObjectData)) {
-				for (auto value: arrayValue) {
-					PresenceUpdateData newData{ value.value() };
-					newData.guildId = this->id;
-					this->presences.emplace_back(std::move(newData));
+			} else if (key == "presences") {
+				if (GuildMembers::doWeCacheGuildMembers() && getArray(arrayValue, value)) {
+					this->presences.clear();
+					for (auto presence: arrayValue) {
+						PresenceUpdateData newData{ presence.value() };
+						newData.guildId = this->id;
+						this->presences.emplace_back(std::move(newData));
+					}
 				}
-			}
-		}
-
-		if (Channels::doWeCacheChannels()) {
-			this->channels.clear();
-			if (getArray(arrayValue, "channels", jsonObjectData)) {
-				for (auto value: arrayValue) {
-					ChannelData newData{ value.value() };
-					newData.guildId = this->id;
-					this->channels.emplace_back(newData.id);
-					Channels::insertChannel(std::move(newData));
+			} else if (key == "roles") {
+				if (Roles::doWeCacheRoles() && getArray(arrayValue, value)) {
+					this->roles.clear();
+					for (auto role: arrayValue) {
+						RoleData newData{ role.value() };
+						newData.guildId = this->id;
+						this->roles.emplace_back(newData.id);
+						PermissionEngine::updateRole(this->id, newData.id, static_cast<uint64_t>(newData.permissions));
+						Roles::insertRole(std::move(newData));
+					}
+				}
+			} else if (key == "channels") {
+				if (Channels::doWeCacheChannels() && getArray(arrayValue, value)) {
+					this->channels.clear();
+					for (auto channel: arrayValue) {
+						ChannelData newData{ channel.value() };
+						newData.guildId = this->id;
+						this->channels.emplace_back(newData.id);
+						PermissionEngine::updateChannel(newData);
+						Channels::insertChannel(std::move(newData));
+					}
 				}
+			} else if (key == "voice_states") {
+				if (getArray(arrayValue, value)) {
+					for (auto voiceState: arrayValue) {
+						VoiceStateDataLight dataNew{ voiceState.value() };
+						dataNew.guildId = this->id;
+						GuildMembers::vsCache.emplace(std::move(dataNew));
+					}
+				}
+			} else if (key == "threads") {
+				collectIds(this->threads, value);
+			} else if (key == "stickers") {
+				collectIds(this->stickers, value);
+			} else if (key == "emojis") {
+				collectIds(this->emoji, value);
+			} else if (key == "stage_instances") {
+				collectIds(this->stageInstances, value);
+			} else if (key == "guild_scheduled_events") {
+				collectIds(this->guildScheduledEvents, value);
+			} else if (key == "widget_enabled") {
+				newFlags = setBool(newFlags, GuildFlags::WidgetEnabled, getBool(value));
+			} else if (key == "unavailable") {
+				newFlags = setBool(newFlags, GuildFlags::Unavailable, getBool(value));
+			} else if (key == "owner") {
+				newFlags = setBool(newFlags, GuildFlags::Owner, getBool(value));
+			} else if (key == "large") {
+				newFlags = setBool(newFlags, GuildFlags::Large, getBool(value));
+			} else if (key == "owner_id") {
+				this->ownerId = getId(value);
+				PermissionEngine::updateOwner(this->id, this->ownerId);
+			} else if (key == "member_count") {
+				this->memberCount = static_cast<uint32_t>(getUint64(value));
+			} else if (key == "joined_at") {
+				this->joinedAt = getString(value);
+			} else if (key == "icon") {
+				this->icon = getString(value);
+			} else if (key == "name") {
+				this->name = StringWrapper::intern(getString(value));
 			}
 		}
+
+		this->flags = static_cast<GuildFlags>(newFlags);
 	}
 
 	GuildDataVector::GuildDataVector(simdjson::ondemand::value jsonObjectData) {
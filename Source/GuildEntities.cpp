@@ -302,6 +302,7 @@ namespace DiscordCoreAPI {
 					RoleData newData{ value.value() };
 					newData.guildId = this->id;
 					this->roles.emplace_back(newData);
+					PermissionEngine::updateRole(this->id, newData.id, static_cast<uint64_t>(newData.permissions));
 					Roles::insertRole(std::move(newData));
 				}
 			}
@@ -322,7 +323,7 @@ namespace DiscordCoreAPI {
 			for (auto value: arrayValue) {
 				VoiceStateDataLight dataNew{ value.value() };
 				dataNew.guildId = this->id;
-				GuildMembers::vsCache[dataNew] = dataNew;
+				GuildMembers::vsCache.emplace(std::move(dataNew));
 			}
 		}
 
@@ -345,6 +346,7 @@ namespace DiscordCoreAPI {
 					ChannelData newData{ value.value() };
 					newData.guildId = this->id;
 					this->channels.emplace_back(newData);
+					PermissionEngine::updateChannel(newData);
 					Channels::insertChannel(std::move(newData));
 				}
 			}
@@ -354,7 +356,7 @@ namespace DiscordCoreAPI {
 
 		this->icon = getString(jsonObjectData, "icon");
 
-		this->name = getString(jsonObjectData, "name");
+		this->name = StringWrapper::intern(getString(jsonObjectData, "name"));
 
 		this->icon = getString(jsonObjectData, "icon_hash");
 
@@ -366,6 +368,7 @@ namespace DiscordCoreAPI {
 		newFlags = setBool(newFlags, GuildFlags::Owner, getBool(jsonObjectData, "owner"));
 
 		this->ownerId = getId(jsonObjectData, "owner_id");
+		PermissionEngine::updateOwner(this->id, this->ownerId);
 
 		this->preferredLocale = getString(jsonObjectData, "preferred_locale");
 
@@ -527,6 +530,7 @@ namespace DiscordCoreAPI {
 	void Guilds::initialize(DiscordCoreInternal::HttpsClient* client, DiscordCoreClient* discordCoreClientNew,
 		ConfigManager* configManagerNew) {
 		Guilds::doWeCacheGuildsBool = configManagerNew->doWeCacheGuilds();
+		Guilds::cache.setPolicy(configManagerNew->getCacheOptions().guildPolicy);
 		Guilds::discordCoreClient = discordCoreClientNew;
 		Guilds::httpsClient = client;
 	}
@@ -586,10 +590,11 @@ namespace DiscordCoreAPI {
 	CoRoutine<std::vector<GuildData>> Guilds::getAllGuildsAsync() {
 		co_await NewThreadAwaitable<std::vector<GuildData>>();
 		GuildDataVector guildVector{};
-		for (auto value: Guilds::getCache()) {
-			value.discordCoreClient = Guilds::discordCoreClient;
-			guildVector.guilds.emplace_back(std::move(value));
-		}
+		Guilds::getCache().forEach([&](const GuildData& value) {
+			GuildData guild{ value };
+			guild.discordCoreClient = Guilds::discordCoreClient;
+			guildVector.guilds.emplace_back(std::move(guild));
+		});
 		co_return guildVector;
 	}
 
@@ -601,8 +606,8 @@ namespace DiscordCoreAPI {
 		workload.callStack = "Guilds::getGuildAsync()";
 		Guild data{};
 		data = Guilds::httpsClient->submitWorkloadAndGetResult<Guild>(workload, &data);
-		if (Guilds::getCache().contains(data)) {
-			data = Guilds::getCache().at(data);
+		if (auto cachedGuild = Guilds::getCache().find(data.id)) {
+			data = *cachedGuild;
 		} else {
 			Guilds::insertGuild(data);
 		}
@@ -611,19 +616,21 @@ namespace DiscordCoreAPI {
 	}
 
 	GuildData Guilds::getCachedGuild(GetGuildData dataPackage) {
-		Guild data{};
-		data.id = dataPackage.guildId;
-		if (!Guilds::getCache().contains(data)) {
-			auto guild = Guilds::getGuildAsync({ .guildId = dataPackage.guildId }).get();
+		if (auto cachedGuild = Guilds::getCache().find(dataPackage.guildId)) {
+			GuildData guild = *cachedGuild;
 			guild.discordCoreClient = Guilds::discordCoreClient;
 			return guild;
 		} else {
-			GuildData guild = Guilds::getCache().at(data);
+			auto guild = Guilds::getGuildAsync({ .guildId = dataPackage.guildId }).get();
 			guild.discordCoreClient = Guilds::discordCoreClient;
 			return guild;
 		}
 	}
 
+	std::shared_ptr<const GuildData> Guilds::getCachedGuildView(GetGuildData dataPackage) {
+		return Guilds::getCache().find(dataPackage.guildId);
+	}
+
 	CoRoutine<GuildPreviewData> Guilds::getGuildPreviewAsync(GetGuildPreviewData dataPackage) {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Preview };
 		co_await NewThreadAwaitable<GuildPreviewData>();
@@ -649,8 +656,8 @@ namespace DiscordCoreAPI {
 		Guild data{};
 		data = Guilds::httpsClient->submitWorkloadAndGetResult<Guild>(workload, &data);
 		data.discordCoreClient = Guilds::discordCoreClient;
-		if (Guilds::getCache().contains(data)) {
-			data = Guilds::getCache().at(data);
+		if (auto cachedGuild = Guilds::getCache().find(data.id)) {
+			data = *cachedGuild;
 		} else {
 			Guilds::insertGuild(data);
 		}
@@ -692,6 +699,36 @@ namespace DiscordCoreAPI {
 		co_return Guilds::httpsClient->submitWorkloadAndGetResult<BanDataVector>(workload, &returnValue);
 	}
 
+	PageIterator<BanData, GetGuildBansData> Guilds::iterateGuildBans(GetGuildBansData dataPackage) {
+		if (dataPackage.limit == 0 || dataPackage.limit > 1000) {
+			dataPackage.limit = 1000;
+		}
+		auto collectFunction = [](GetGuildBansData dataPackage) {
+			return Guilds::getGuildBansAsync(dataPackage).get();
+		};
+		auto advanceFunction = [](GetGuildBansData& dataPackage, std::vector<BanData>& page) {
+			if (page.size() < dataPackage.limit) {
+				return false;
+			}
+			uint64_t lowestId{ std::numeric_limits<uint64_t>::max() };
+			uint64_t highestId{};
+			for (auto& value: page) {
+				lowestId = std::min(lowestId, static_cast<uint64_t>(value.user.id));
+				highestId = std::max(highestId, static_cast<uint64_t>(value.user.id));
+			}
+			if (dataPackage.after == 0 && dataPackage.before != 0) {
+				dataPackage.before = lowestId;
+			} else {
+				dataPackage.after = highestId;
+			}
+			return true;
+		};
+		auto budgetFunction = [] {
+			return Guilds::httpsClient->getRemainingRequests(DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Bans) > 1;
+		};
+		return PageIterator<BanData, GetGuildBansData>{ dataPackage, collectFunction, advanceFunction, budgetFunction };
+	}
+
 	CoRoutine<BanData> Guilds::getGuildBanAsync(GetGuildBanData dataPackage) {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Ban };
 		co_await NewThreadAwaitable<BanData>();
@@ -1088,29 +1125,26 @@ namespace DiscordCoreAPI {
 		co_return Guilds::httpsClient->submitWorkloadAndGetResult<void>(workload);
 	}
 
-	StopWatch stopWatch{ 5s };
-	void Guilds::insertGuild(GuildData guild) {
+	void Guilds::insertGuild(const GuildData& guild) {
+		if (guild.id == 0 || !Guilds::doWeCacheGuilds()) {
+			return;
+		}
+		GuildData guildNew{ guild };
+		Guilds::insertGuild(std::move(guildNew));
+	}
+
+	void Guilds::insertGuild(GuildData&& guild) {
 		if (guild.id == 0) {
 			return;
 		}
 		if (Guilds::doWeCacheGuilds()) {
 			guild.discordCoreClient = Guilds::discordCoreClient;
-			if (!Guilds::getCache().contains(guild)) {
-				Guilds::getCache().emplace(std::move(guild));
-			} else {
-				Guilds::getCache()[guild] = std::move(guild);
-			}
-			if (Guilds::getCache().size() % 100 == 0) {
-				std::cout << "THE GUILD COUNT: " << Guilds::getCache().size() << ", TOTAL TIME: " << stopWatch.totalTimePassed().count()
-						  << "\n,THREAD ID: " << std::this_thread::get_id() << std::endl;
-			}
+			Guilds::getCache().emplace(std::move(guild));
 		}
 	}
 
 	void Guilds::removeGuild(const Snowflake guildId) {
-		GuildData data{};
-		data.id = guildId;
-		Guilds::getCache().erase(data);
+		Guilds::getCache().erase(guildId);
 	};
 
 	ObjectCache<GuildData>& Guilds::getCache() {
@@ -139,7 +139,7 @@ namespace DiscordCoreAPI {
 
 		this->flags = static_cast<GuildMemberFlags>(newFlags);
 
-		this->nick = getString(jsonObjectData, "nick");
+		this->nick = StringWrapper::intern(getString(jsonObjectData, "nick"));
 
 		this->communicationDisabledUntil = getString(jsonObjectData, "communication_disabled_until");
 
@@ -150,8 +150,255 @@ namespace DiscordCoreAPI {
 		return this->guildMembers;
 	}
 
+	GuildMemberColumns::GuildMemberColumns(Snowflake guildIdNew) noexcept {
+		this->guildId = guildIdNew;
+	}
+
+	void GuildMemberColumns::insert(GuildMemberData& guildMember) {
+		uint32_t roleSetId = this->internRoleSet(guildMember.roles);
+		uint32_t row = this->findRow(guildMember.id);
+		if (row == npos) {
+			if (this->ids.size() >= npos - 1) {
+				this->releaseRoleSet(roleSetId);
+				return;
+			}
+			row = static_cast<uint32_t>(this->ids.size());
+			if ((this->ids.size() + 1) * 4 > this->rowIndices.size() * 3) {
+				this->growRowIndices();
+			}
+			this->ids.emplace_back(guildMember.id);
+			this->roleSetIds.emplace_back(roleSetId);
+			this->nickOffsets.emplace_back(0);
+			this->nickLengths.emplace_back(0);
+			this->flags.emplace_back(guildMember.flags);
+			this->permissions.emplace_back(guildMember.permissions);
+			this->joinedAts.emplace_back(guildMember.joinedAt);
+			this->avatars.emplace_back(guildMember.avatar);
+			this->placeRow(guildMember.id, row);
+		} else {
+			this->releaseRoleSet(this->roleSetIds[row]);
+			this->roleSetIds[row] = roleSetId;
+			this->flags[row] = guildMember.flags;
+			this->permissions[row] = guildMember.permissions;
+			this->joinedAts[row] = guildMember.joinedAt;
+			this->avatars[row] = guildMember.avatar;
+		}
+		this->setNick(row, static_cast<std::string_view>(guildMember.nick));
+	}
+
+	bool GuildMemberColumns::erase(Snowflake guildMemberId) {
+		uint32_t row = this->findRow(guildMemberId);
+		if (row == npos) {
+			return false;
+		}
+		this->releaseRoleSet(this->roleSetIds[row]);
+		this->nickGarbageLength += this->nickLengths[row];
+		this->eraseRowIndex(guildMemberId);
+		uint32_t lastRow = static_cast<uint32_t>(this->ids.size() - 1);
+		if (row != lastRow) {
+			this->eraseRowIndex(this->ids[lastRow]);
+			this->ids[row] = this->ids[lastRow];
+			this->roleSetIds[row] = this->roleSetIds[lastRow];
+			this->nickOffsets[row] = this->nickOffsets[lastRow];
+			this->nickLengths[row] = this->nickLengths[lastRow];
+			this->flags[row] = this->flags[lastRow];
+			this->permissions[row] = this->permissions[lastRow];
+			this->joinedAts[row] = this->joinedAts[lastRow];
+			this->avatars[row] = this->avatars[lastRow];
+			this->placeRow(this->ids[row], row);
+		}
+		this->ids.pop_back();
+		this->roleSetIds.pop_back();
+		this->nickOffsets.pop_back();
+		this->nickLengths.pop_back();
+		this->flags.pop_back();
+		this->permissions.pop_back();
+		this->joinedAts.pop_back();
+		this->avatars.pop_back();
+		if (this->ids.size() == 0) {
+			this->nickArena.clear();
+			this->nickGarbageLength = 0;
+		}
+		return true;
+	}
+
+	bool GuildMemberColumns::getGuildMember(Snowflake guildMemberId, GuildMemberData& guildMember) const {
+		uint32_t row = this->findRow(guildMemberId);
+		if (row == npos) {
+			return false;
+		}
+		guildMember.id = guildMemberId;
+		guildMember.guildId = this->guildId;
+		guildMember.roles = this->roleSets[this->roleSetIds[row]];
+		guildMember.nick = std::string_view{ this->nickArena.data() + this->nickOffsets[row], this->nickLengths[row] };
+		guildMember.flags = this->flags[row];
+		guildMember.permissions = this->permissions[row];
+		guildMember.joinedAt = this->joinedAts[row];
+		guildMember.avatar = this->avatars[row];
+		return true;
+	}
+
+	bool GuildMemberColumns::contains(Snowflake guildMemberId) const noexcept {
+		return this->findRow(guildMemberId) != npos;
+	}
+
+	uint64_t GuildMemberColumns::getMemoryFootprint() const noexcept {
+		uint64_t returnValue{ sizeof(GuildMemberColumns) };
+		returnValue += this->ids.capacity() * sizeof(Snowflake);
+		returnValue += this->roleSetIds.capacity() * sizeof(uint32_t);
+		returnValue += this->nickOffsets.capacity() * sizeof(uint32_t);
+		returnValue += this->nickLengths.capacity() * sizeof(uint16_t);
+		returnValue += this->flags.capacity() * sizeof(GuildMemberFlags);
+		returnValue += this->permissions.capacity() * sizeof(Permissions);
+		returnValue += this->joinedAts.capacity() * sizeof(TimeStamp);
+		returnValue += this->avatars.capacity() * sizeof(IconHash);
+		returnValue += this->rowIndices.capacity() * sizeof(uint32_t);
+		returnValue += this->nickArena.capacity();
+		returnValue += this->roleSets.capacity() * sizeof(std::vector<Snowflake>) + this->roleSetLength * sizeof(Snowflake);
+		returnValue += this->roleSetRefCounts.capacity() * sizeof(uint32_t) + this->freeRoleSets.capacity() * sizeof(uint32_t);
+		returnValue += this->roleSetIndices.size() * (sizeof(std::pair<uint64_t, uint32_t>) + 2 * sizeof(void*));
+		return returnValue;
+	}
+
+	uint64_t GuildMemberColumns::size() const noexcept {
+		return this->ids.size();
+	}
+
+	uint32_t GuildMemberColumns::findRow(Snowflake guildMemberId) const noexcept {
+		if (this->rowIndices.size() == 0) {
+			return npos;
+		}
+		uint64_t mask = this->rowIndices.size() - 1;
+		for (uint64_t index = getCacheHash(guildMemberId) & mask; this->rowIndices[index] != 0; index = (index + 1) & mask) {
+			uint32_t row = this->rowIndices[index] - 1;
+			if (this->ids[row] == guildMemberId) {
+				return row;
+			}
+		}
+		return npos;
+	}
+
+	uint32_t GuildMemberColumns::internRoleSet(std::vector<Snowflake>& roles) {
+		std::sort(roles.begin(), roles.end(), [](const Snowflake& lhs, const Snowflake& rhs) {
+			return static_cast<uint64_t>(lhs) < static_cast<uint64_t>(rhs);
+		});
+		uint64_t hash{ roles.size() };
+		for (auto& value: roles) {
+			hash = mixCacheHash(hash ^ static_cast<uint64_t>(value));
+		}
+		auto range = this->roleSetIndices.equal_range(hash);
+		for (auto iterator = range.first; iterator != range.second; ++iterator) {
+			if (this->roleSets[iterator->second] == roles) {
+				++this->roleSetRefCounts[iterator->second];
+				return iterator->second;
+			}
+		}
+		uint32_t returnValue{};
+		if (this->freeRoleSets.size() > 0) {
+			returnValue = this->freeRoleSets.back();
+			this->freeRoleSets.pop_back();
+			this->roleSets[returnValue] = roles;
+			this->roleSetRefCounts[returnValue] = 1;
+		} else {
+			returnValue = static_cast<uint32_t>(this->roleSets.size());
+			this->roleSets.emplace_back(roles);
+			this->roleSetRefCounts.emplace_back(1);
+		}
+		this->roleSetLength += roles.size();
+		this->roleSetIndices.emplace(hash, returnValue);
+		return returnValue;
+	}
+
+	void GuildMemberColumns::releaseRoleSet(uint32_t roleSetId) {
+		if (--this->roleSetRefCounts[roleSetId] > 0) {
+			return;
+		}
+		auto& roles = this->roleSets[roleSetId];
+		uint64_t hash{ roles.size() };
+		for (auto& value: roles) {
+			hash = mixCacheHash(hash ^ static_cast<uint64_t>(value));
+		}
+		auto range = this->roleSetIndices.equal_range(hash);
+		for (auto iterator = range.first; iterator != range.second; ++iterator) {
+			if (iterator->second == roleSetId) {
+				this->roleSetIndices.erase(iterator);
+				break;
+			}
+		}
+		this->roleSetLength -= roles.size();
+		roles = std::vector<Snowflake>{};
+		this->freeRoleSets.emplace_back(roleSetId);
+	}
+
+	void GuildMemberColumns::setNick(uint32_t row, std::string_view nick) {
+		uint64_t length = std::min<uint64_t>(nick.size(), std::numeric_limits<uint16_t>::max());
+		if (length <= this->nickLengths[row]) {
+			this->nickGarbageLength += this->nickLengths[row] - length;
+			std::memcpy(this->nickArena.data() + this->nickOffsets[row], nick.data(), length);
+			this->nickLengths[row] = static_cast<uint16_t>(length);
+			return;
+		}
+		this->nickGarbageLength += this->nickLengths[row];
+		this->nickLengths[row] = 0;
+		if (this->nickGarbageLength > 4096 && this->nickGarbageLength * 2 > this->nickArena.size()) {
+			this->compactNicks();
+		}
+		if (this->nickArena.size() + length > npos) {
+			return;
+		}
+		this->nickOffsets[row] = static_cast<uint32_t>(this->nickArena.size());
+		this->nickLengths[row] = static_cast<uint16_t>(length);
+		this->nickArena.append(nick.data(), length);
+	}
+
+	void GuildMemberColumns::compactNicks() {
+		std::string nickArenaNew{};
+		nickArenaNew.reserve(this->nickArena.size() - this->nickGarbageLength);
+		for (uint64_t x = 0; x < this->ids.size(); ++x) {
+			uint32_t offset = static_cast<uint32_t>(nickArenaNew.size());
+			nickArenaNew.append(this->nickArena.data() + this->nickOffsets[x], this->nickLengths[x]);
+			this->nickOffsets[x] = offset;
+		}
+		this->nickArena = std::move(nickArenaNew);
+		this->nickGarbageLength = 0;
+	}
+
+	void GuildMemberColumns::placeRow(Snowflake guildMemberId, uint32_t row) noexcept {
+		uint64_t mask = this->rowIndices.size() - 1;
+		uint64_t index = getCacheHash(guildMemberId) & mask;
+		while (this->rowIndices[index] != 0) {
+			index = (index + 1) & mask;
+		}
+		this->rowIndices[index] = row + 1;
+	}
+
+	void GuildMemberColumns::eraseRowIndex(Snowflake guildMemberId) noexcept {
+		uint64_t mask = this->rowIndices.size() - 1;
+		uint64_t index = getCacheHash(guildMemberId) & mask;
+		while (this->ids[this->rowIndices[index] - 1] != guildMemberId) {
+			index = (index + 1) & mask;
+		}
+		this->rowIndices[index] = 0;
+		for (uint64_t next = (index + 1) & mask; this->rowIndices[next] != 0; next = (next + 1) & mask) {
+			uint64_t home = getCacheHash(this->ids[this->rowIndices[next] - 1]) & mask;
+			if (((next - home) & mask) >= ((next - index) & mask)) {
+				this->rowIndices[index] = this->rowIndices[next];
+				this->rowIndices[next] = 0;
+				index = next;
+			}
+		}
+	}
+
+	void GuildMemberColumns::growRowIndices() {
+		this->rowIndices = std::vector<uint32_t>(this->rowIndices.size() == 0 ? 16 : this->rowIndices.size() * 2);
+		for (uint32_t x = 0; x < this->ids.size(); ++x) {
+			this->placeRow(this->ids[x], x);
+		}
+	}
+
 	void GuildMembers::initialize(DiscordCoreInternal::HttpsClient* client, ConfigManager* configManagerNew) {
 		GuildMembers::doWeCacheGuildMembersBool = configManagerNew->doWeCacheUsers();
+		GuildMembers::cache.setPolicy(configManagerNew->getCacheOptions().guildMemberTablePolicy);
 		GuildMembers::httpsClient = client;
 	}
 
@@ -165,8 +412,13 @@ namespace DiscordCoreAPI {
 		data.guildId = dataPackage.guildId;
 		data.id = dataPackage.guildMemberId;
 		data = GuildMembers::httpsClient->submitWorkloadAndGetResult<GuildMember>(workload, &data);
-		if (GuildMembers::cache.contains(data)) {
-			data = GuildMembers::cache.at(data);
+		GuildMemberData cachedGuildMember{};
+		bool isItPresent{};
+		GuildMembers::cache.visit(dataPackage.guildId, [&](const GuildMemberColumns& guildMembers) {
+			isItPresent = guildMembers.getGuildMember(data.id, cachedGuildMember);
+		});
+		if (isItPresent) {
+			data = std::move(cachedGuildMember);
 		} else {
 			GuildMembers::insertGuildMember(data);
 		}
@@ -175,15 +427,29 @@ namespace DiscordCoreAPI {
 	}
 
 	GuildMemberData GuildMembers::getCachedGuildMember(GetGuildMemberData dataPackage) {
-		GuildMemberData key{};
-		key.id = dataPackage.guildMemberId;
-		key.guildId = dataPackage.guildId;
-		if (GuildMembers::cache.contains(key)) {
-			return GuildMembers::cache.at(key);
+		GuildMemberData returnData{};
+		bool isItPresent{};
+		GuildMembers::cache.visit(dataPackage.guildId, [&](const GuildMemberColumns& guildMembers) {
+			isItPresent = guildMembers.getGuildMember(dataPackage.guildMemberId, returnData);
+		});
+		if (isItPresent) {
+			return returnData;
 		}
 		return GuildMembers::getGuildMemberAsync(dataPackage).get();
 	}
 
+	std::shared_ptr<const GuildMemberData> GuildMembers::getCachedGuildMemberView(GetGuildMemberData dataPackage) {
+		auto returnData = std::make_shared<GuildMemberData>();
+		bool isItPresent{};
+		GuildMembers::cache.visit(dataPackage.guildId, [&](const GuildMemberColumns& guildMembers) {
+			isItPresent = guildMembers.getGuildMember(dataPackage.guildMemberId, *returnData);
+		});
+		if (isItPresent) {
+			return returnData;
+		}
+		return nullptr;
+	}
+
 	CoRoutine<std::vector<GuildMember>> GuildMembers::listGuildMembersAsync(ListGuildMembersData dataPackage) {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Members };
 		co_await NewThreadAwaitable<std::vector<GuildMember>>();
@@ -202,6 +468,30 @@ namespace DiscordCoreAPI {
 		co_return GuildMembers::httpsClient->submitWorkloadAndGetResult<GuildMemberVector>(workload, &returnValue);
 	}
 
+	PageIterator<GuildMember, ListGuildMembersData> GuildMembers::iterateGuildMembers(ListGuildMembersData dataPackage) {
+		if (dataPackage.limit <= 0 || dataPackage.limit > 1000) {
+			dataPackage.limit = 1000;
+		}
+		auto collectFunction = [](ListGuildMembersData dataPackage) {
+			return GuildMembers::listGuildMembersAsync(dataPackage).get();
+		};
+		auto advanceFunction = [](ListGuildMembersData& dataPackage, std::vector<GuildMember>& page) {
+			if (page.size() < static_cast<uint64_t>(dataPackage.limit)) {
+				return false;
+			}
+			uint64_t highestId{};
+			for (auto& value: page) {
+				highestId = std::max(highestId, static_cast<uint64_t>(value.id));
+			}
+			dataPackage.after = highestId;
+			return true;
+		};
+		auto budgetFunction = [] {
+			return GuildMembers::httpsClient->getRemainingRequests(DiscordCoreInternal::HttpsWorkloadType::Get_Guild_Members) > 1;
+		};
+		return PageIterator<GuildMember, ListGuildMembersData>{ dataPackage, collectFunction, advanceFunction, budgetFunction };
+	}
+
 	CoRoutine<std::vector<GuildMember>> GuildMembers::searchGuildMembersAsync(SearchGuildMembersData dataPackage) {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Search_Guild_Members };
 		co_await NewThreadAwaitable<std::vector<GuildMember>>();
@@ -266,8 +556,13 @@ namespace DiscordCoreAPI {
 		data.guildId = dataPackage.guildId;
 		data.id = dataPackage.guildMemberId;
 		data = GuildMembers::httpsClient->submitWorkloadAndGetResult<GuildMember>(workload, &data);
-		if (GuildMembers::cache.contains(data)) {
-			data = GuildMembers::cache.at(data);
+		GuildMemberData cachedGuildMember{};
+		bool isItPresent{};
+		GuildMembers::cache.visit(dataPackage.guildId, [&](const GuildMemberColumns& guildMembers) {
+			isItPresent = guildMembers.getGuildMember(data.id, cachedGuildMember);
+		});
+		if (isItPresent) {
+			data = std::move(cachedGuildMember);
 		} else {
 			GuildMembers::insertGuildMember(data);
 		}
@@ -342,7 +637,7 @@ namespace DiscordCoreAPI {
 		co_return GuildMembers::modifyGuildMemberAsync(dataPackage01).get();
 	}
 
-	ObjectCache<GuildMemberData>& GuildMembers::getCache() {
+	ObjectCache<GuildMemberColumns>& GuildMembers::getCache() {
 		return GuildMembers::cache;
 	};
 
@@ -354,15 +649,11 @@ namespace DiscordCoreAPI {
 		if (voiceState.userId == 0) {
 			return;
 		}
-		if (!GuildMembers::vsCache.contains(voiceState)) {
-			GuildMembers::vsCache.emplace(std::move(voiceState));
-		} else {
-			GuildMembers::vsCache[voiceState] = std::move(voiceState);
-		}
+		GuildMembers::vsCache.emplace(std::move(voiceState));
 	}
 
 	void GuildMembers::removeVoiceState(VoiceStateData voiceState) {
-		GuildMembers::vsCache.erase(voiceState);
+		GuildMembers::vsCache.erase(getCacheKey(voiceState));
 	}
 
 	void GuildMembers::insertGuildMember(GuildMemberData guildMember) {
@@ -370,19 +661,16 @@ namespace DiscordCoreAPI {
 			return;
 		}
 		if (GuildMembers::doWeCacheGuildMembers()) {
-			if (!GuildMembers::cache.contains(guildMember)) {
-				GuildMembers::cache.emplace(std::move(guildMember));
-			} else {
-				GuildMembers::cache[guildMember] = std::move(guildMember);
-			}
-			if (GuildMembers::cache.size() % 10000 == 0) {
-				std::cout << "THE GUILDMEMBER COUNT: " << GuildMembers::cache.size() << std::endl;
-			}
+			GuildMembers::cache.emplaceOrModify(GuildMemberColumns{ guildMember.guildId }, [&](GuildMemberColumns& guildMembers) {
+				guildMembers.insert(guildMember);
+			});
 		}
 	}
 
 	void GuildMembers::removeGuildMember(GuildMemberData guildMember) {
-		GuildMembers::cache.erase(guildMember);
+		GuildMembers::cache.modify(guildMember.guildId, [&](GuildMemberColumns& guildMembers) {
+			guildMembers.erase(guildMember.id);
+		});
 	};
 
 	bool GuildMembers::doWeCacheGuildMembers() {
@@ -391,6 +679,6 @@ namespace DiscordCoreAPI {
 
 	DiscordCoreInternal::HttpsClient* GuildMembers::httpsClient{ nullptr };
 	ObjectCache<VoiceStateDataLight> GuildMembers::vsCache{};
-	ObjectCache<GuildMemberData> GuildMembers::cache{};
+	ObjectCache<GuildMemberColumns> GuildMembers::cache{};
 	bool GuildMembers::doWeCacheGuildMembersBool{};
 };
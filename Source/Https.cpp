@@ -32,6 +32,18 @@ namespace DiscordCoreInternal {
 
 	HttpsError::HttpsError(std::string message) : DCAException(message){};
 
+	bool compareCaseInsensitive(std::string_view first, std::string_view second) {
+		if (first.size() != second.size()) {
+			return false;
+		}
+		for (uint64_t x = 0; x < first.size(); ++x) {
+			if (tolower(static_cast<uint8_t>(first[x])) != tolower(static_cast<uint8_t>(second[x]))) {
+				return false;
+			}
+		}
+		return true;
+	}
+
 	HttpsRnRBuilder::HttpsRnRBuilder(bool doWePrintErrorMessagesNew) {
 		this->doWePrintErrorMessages = doWePrintErrorMessagesNew;
 	}
@@ -54,23 +66,8 @@ namespace DiscordCoreInternal {
 	};
 
 	HttpsResponseData HttpsRnRBuilder::finalizeReturnValues(RateLimitData& rateLimitData) {
-		if (static_cast<HttpsConnection*>(this)->data.responseData.size() >= static_cast<HttpsConnection*>(this)->data.contentLength &&
-			static_cast<HttpsConnection*>(this)->data.contentLength > 0) {
-			std::string string =
-				static_cast<HttpsConnection*>(this)->data.responseData.substr(0, static_cast<HttpsConnection*>(this)->data.contentLength);
-			static_cast<HttpsConnection*>(this)->data.responseData = std::move(string);
-		} else if (static_cast<HttpsConnection*>(this)->inputBufferReal.size() > 0) {
-			std::string string = std::string{ static_cast<HttpsConnection*>(this)->inputBufferReal.data(),
-				static_cast<HttpsConnection*>(this)->inputBufferReal.size() };
-			if (string.size() > 0 && string.find_first_of('{') != std::string::npos && string.find_last_of('}') != std::string::npos) {
-				static_cast<HttpsConnection*>(this)->data.responseData =
-					string.substr(string.find_first_of('{'), string.size() - (string.find_first_of('{')));
-			} else if (string.size() > 0) {
-				static_cast<HttpsConnection*>(this)->data.responseData = std::move(string);
-			}
-		}
 		this->updateRateLimitData(rateLimitData, static_cast<HttpsConnection*>(this)->data.responseHeaders);
-		return static_cast<HttpsConnection*>(this)->data;
+		return std::move(static_cast<HttpsConnection*>(this)->data);
 	}
 
 	std::string HttpsRnRBuilder::buildRequest(const HttpsWorkloadData& workload) {
@@ -107,162 +104,199 @@ namespace DiscordCoreInternal {
 			}
 			returnString += "Connection: Keep-Alive\r\n";
 			returnString += "Host: " + baseUrlNew + "\r\n";
-			returnString += "Content-Length: " + std::to_string(workload.content.size()) + "\r\n\r\n";
-			returnString += workload.content;
+			if (workload.bodySources.size() > 0) {
+				returnString += "Content-Length: " + std::to_string(workload.getBodySize()) + "\r\n\r\n";
+			} else {
+				returnString += "Content-Length: " + std::to_string(workload.content.size()) + "\r\n\r\n";
+				returnString += workload.content;
+			}
 		}
 		return returnString;
 	}
 
-	uint64_t HttpsRnRBuilder::parseHeaders(StringBuffer& other) {
-		if (static_cast<std::string_view>(other).find("\r\n\r\n") != std::string::npos) {
-			DiscordCoreAPI::StopWatch stopWatch{ 1500ms };
-			std::string newString{};
-			newString.insert(newString.begin(), other.begin(),
-				other.begin() + static_cast<std::string_view>(other).find("\r\n\r\n") + std::string("\r\n\r\n").size());
-			other.erase(newString.size());
-			while (newString.size() > 0 && newString.find(":") != std::string::npos && newString.find("\r\n") != std::string::npos) {
-				if (stopWatch.hasTimePassed()) {
+	bool HttpsRnRBuilder::parseData(std::string_view other) {
+		auto& data = static_cast<HttpsConnection*>(this)->data;
+		std::string_view line{};
+		while (other.size() > 0 && data.currentState != HttpsState::Complete) {
+			switch (data.currentState) {
+				case HttpsState::Collecting_Code: {
+					if (this->collectLine(other, line)) {
+						this->parseCode(line);
+					}
 					break;
 				}
-				int64_t currentOffset{};
-				std::string lineString = newString.substr(0, newString.find("\r\n") + 2);
-				currentOffset = lineString.size();
-				std::string key = lineString.substr(0, lineString.find(":"));
-				std::string value = lineString.substr(lineString.find(":") + 2, lineString.size() - key.size() - 2);
-				value = value.substr(0, value.find("\r\n"));
-				static_cast<HttpsConnection*>(this)->data.responseHeaders[key] = value;
-				std::string tempString{};
-				tempString.insert(tempString.begin(), newString.begin() + currentOffset, newString.end());
-				newString = tempString;
-			}
-
-			if (static_cast<HttpsConnection*>(this)->data.responseHeaders.contains("Transfer-Encoding") &&
-					static_cast<HttpsConnection*>(this)->data.responseHeaders["Transfer-Encoding"] == "chunked" ||
-				static_cast<HttpsConnection*>(this)->data.responseHeaders.contains("transfer-encoding") &&
-					static_cast<HttpsConnection*>(this)->data.responseHeaders["transfer-encoding"] == "chunked") {
-				this->isItChunked = true;
-			}
-			this->doWeHaveHeaders = true;
-			static_cast<HttpsConnection*>(this)->data.currentState = HttpsState::Collecting_Size;
-			return newString.size();
-		}
-		return 0;
-	}
-
-	bool HttpsRnRBuilder::parseChunk(StringBuffer& other) {
-		if (this->isItChunked) {
-			if (static_cast<std::string_view>(other).find("\r\n0\r\n\r\n") != std::string::npos) {
-				DiscordCoreAPI::StopWatch stopWatch{ 1500ms };
-				while (static_cast<std::string_view>(other).find("\r\n") != static_cast<std::string_view>(other).find("\r\n0\r\n\r\n")) {
-					if (stopWatch.hasTimePassed()) {
-						break;
+				case HttpsState::Collecting_Headers: {
+					if (this->collectLine(other, line)) {
+						this->parseHeader(line);
 					}
-					this->clearCRLF(other);
-					this->parseSize(other);
-					this->clearCRLF(other);
-					if (static_cast<std::string_view>(other).find("\r\n") != static_cast<std::string_view>(other).find("\r\n0\r\n\r\n")) {
-						static_cast<HttpsConnection*>(this)->data.responseData.insert(
-							static_cast<HttpsConnection*>(this)->data.responseData.end(), other.begin(),
-							other.begin() + static_cast<std::string_view>(other).find("\r\n"));
-						other.erase(static_cast<std::string_view>(other).find("\r\n") + 2);
+					break;
+				}
+				case HttpsState::Collecting_Size: {
+					if (this->collectLine(other, line)) {
+						this->parseSize(line);
 					}
+					break;
+				}
+				case HttpsState::Collecting_Contents: {
+					other.remove_prefix(this->parseContents(other));
+					break;
+				}
+				case HttpsState::Collecting_Trailers: {
+					if (this->collectLine(other, line)) {
+						if (line.size() == 0) {
+							data.currentState = HttpsState::Complete;
+						}
+						this->clearLine();
+					}
+					break;
+				}
+				case HttpsState::Complete: {
+					break;
 				}
-				static_cast<HttpsConnection*>(this)->data.responseData.insert(static_cast<HttpsConnection*>(this)->data.responseData.end(),
-					other.begin(), other.begin() + static_cast<std::string_view>(other).find("\r\n0\r\n\r\n"));
-				other.erase(static_cast<std::string_view>(other).find("\r\n0\r\n\r\n"));
-				return false;
-			} else {
-				return true;
-			}
-		} else {
-			if (!this->doWeHaveContentSize) {
-				this->parseSize(other);
-			}
-			if (static_cast<HttpsConnection*>(this)->data.contentLength == 0) {
-				return false;
-			}
-			if (other.size() >= static_cast<uint64_t>(static_cast<HttpsConnection*>(this)->data.contentLength)) {
-				static_cast<HttpsConnection*>(this)->data.responseData.insert(static_cast<HttpsConnection*>(this)->data.responseData.end(),
-					other.begin(), other.begin() + static_cast<HttpsConnection*>(this)->data.contentLength);
-				other.erase(static_cast<HttpsConnection*>(this)->data.contentLength);
-				return false;
-			} else {
-				return true;
 			}
 		}
+		return data.currentState == HttpsState::Complete;
 	}
 
-	uint64_t HttpsRnRBuilder::parseSize(StringBuffer& other) {
-		if (static_cast<HttpsConnection*>(this)->data.responseHeaders.contains("Content-Length")) {
-			static_cast<HttpsConnection*>(this)->data.contentLength =
-				stoll(static_cast<HttpsConnection*>(this)->data.responseHeaders["Content-Length"]);
-			this->doWeHaveContentSize = true;
-			static_cast<HttpsConnection*>(this)->data.currentState = HttpsState::Collecting_Contents;
-			return 0;
+	bool HttpsRnRBuilder::collectLine(std::string_view& other, std::string_view& line) {
+		auto& buffer = static_cast<HttpsConnection*>(this)->inputBufferReal;
+		auto newLineIndex = other.find('\n');
+		if (newLineIndex == std::string_view::npos) {
+			buffer.writeData(other.data(), other.size());
+			other = std::string_view{};
+			return false;
+		}
+		buffer.writeData(other.data(), newLineIndex + 1);
+		other.remove_prefix(newLineIndex + 1);
+		uint64_t lineLength{ buffer.size() - this->lineOffset - 1 };
+		if (lineLength > 0 && buffer[this->lineOffset + lineLength - 1] == '\r') {
+			--lineLength;
+		}
+		line = buffer[LengthData{ this->lineOffset, lineLength }];
+		this->lineOffset = buffer.size();
+		return true;
+	}
+
+	uint64_t HttpsRnRBuilder::parseContents(std::string_view other) {
+		auto& data = static_cast<HttpsConnection*>(this)->data;
+		uint64_t amount{ std::min(static_cast<uint64_t>(other.size()), this->remainingChunkSize) };
+		data.responseData.append(other.data(), amount);
+		if (this->remainingChunkSize != std::numeric_limits<uint64_t>::max()) {
+			this->remainingChunkSize -= amount;
 		}
-		std::string valueString{};
-		uint64_t hexIndex{};
-		bool isThereHexValues{};
-		for (uint64_t x = 0; x < other.size(); ++x) {
-			if (isxdigit(other[x]) != 0 && static_cast<int32_t>(other[x]) != EOF) {
-				isThereHexValues = true;
-				valueString.push_back(other[x]);
-			} else {
-				hexIndex = x;
-				break;
+		if (this->remainingChunkSize == 0) {
+			data.currentState = this->isItChunked ? HttpsState::Collecting_Size : HttpsState::Complete;
+		}
+		return amount;
+	}
+
+	void HttpsRnRBuilder::parseHeader(std::string_view line) {
+		auto& connection = *static_cast<HttpsConnection*>(this);
+		if (line.size() == 0) {
+			this->finalizeHeaders();
+			return;
+		}
+		auto colonIndex = line.find(':');
+		if (colonIndex == std::string_view::npos) {
+			return;
+		}
+		auto key = line.substr(0, colonIndex);
+		auto value = line.substr(colonIndex + 1);
+		while (value.size() > 0 && (value.front() == ' ' || value.front() == '\t')) {
+			value.remove_prefix(1);
+		}
+		while (value.size() > 0 && (value.back() == ' ' || value.back() == '\t')) {
+			value.remove_suffix(1);
+		}
+		HttpsHeaderSpan span{};
+		span.key = LengthData{ static_cast<uint64_t>(key.data() - connection.inputBufferReal.data()), key.size() };
+		span.value = LengthData{ static_cast<uint64_t>(value.data() - connection.inputBufferReal.data()), value.size() };
+		this->headerSpans.emplace_back(span);
+		if (compareCaseInsensitive(key, "content-length")) {
+			uint64_t contentLength{};
+			if (std::from_chars(value.data(), value.data() + value.size(), contentLength).ec == std::errc{}) {
+				connection.data.contentLength = contentLength;
+				this->doWeHaveContentSize = true;
 			}
+		} else if (compareCaseInsensitive(key, "transfer-encoding") && value.find("chunked") != std::string_view::npos) {
+			this->isItChunked = true;
 		}
-		if (!isThereHexValues) {
-			static_cast<HttpsConnection*>(this)->data.contentLength += 0;
-			return 0;
+	}
+
+	void HttpsRnRBuilder::parseSize(std::string_view line) {
+		auto& data = static_cast<HttpsConnection*>(this)->data;
+		line = line.substr(0, line.find(';'));
+		while (line.size() > 0 && (line.back() == ' ' || line.back() == '\t')) {
+			line.remove_suffix(1);
+		}
+		if (line.size() == 0) {
+			this->clearLine();
+			return;
+		}
+		uint64_t chunkSize{};
+		auto result = std::from_chars(line.data(), line.data() + line.size(), chunkSize, 16);
+		this->clearLine();
+		if (result.ec != std::errc{}) {
+			data.currentState = HttpsState::Complete;
+		} else if (chunkSize == 0) {
+			data.currentState = HttpsState::Collecting_Trailers;
 		} else {
-			static_cast<HttpsConnection*>(this)->data.contentLength += stoll(valueString, nullptr, 16);
-			other.erase(hexIndex);
-			this->doWeHaveContentSize = true;
-			static_cast<HttpsConnection*>(this)->data.currentState = HttpsState::Collecting_Contents;
-			return hexIndex;
-		}
-	}
-
-	uint64_t HttpsRnRBuilder::parseCode(StringBuffer& other) {
-		if (static_cast<std::string_view>(other).find("HTTP/1.") != std::string::npos) {
-			uint64_t firstNumberIndex{};
-			uint64_t lastNumberIndex{};
-			bool haveWeStarted{};
-			for (uint64_t x = static_cast<std::string_view>(other).find("HTTP/1.") + std::string("HTTP/1.").size() + 1;
-				 x < static_cast<std::string_view>(other).size(); ++x) {
-				if (!haveWeStarted && (isalnum(static_cast<uint8_t>(other[x])) != 0)) {
-					firstNumberIndex = x;
-					haveWeStarted = true;
-				} else if (haveWeStarted && (isalnum(static_cast<uint8_t>(other[x])) == 0)) {
-					lastNumberIndex = x;
-					break;
-				}
+			data.contentLength += chunkSize;
+			this->remainingChunkSize = chunkSize;
+			data.currentState = HttpsState::Collecting_Contents;
+		}
+	}
+
+	void HttpsRnRBuilder::parseCode(std::string_view line) {
+		auto& data = static_cast<HttpsConnection*>(this)->data;
+		if (line.size() == 0) {
+			this->clearLine();
+			return;
+		}
+		if (line.starts_with("HTTP/1.") && line.find(' ') != std::string_view::npos) {
+			line.remove_prefix(line.find(' ') + 1);
+			uint32_t responseCode{};
+			if (std::from_chars(line.data(), line.data() + line.size(), responseCode).ec == std::errc{}) {
+				data.responseCode = responseCode;
 			}
-			static_cast<HttpsConnection*>(this)->data.responseCode =
-				stoll(static_cast<std::string>(other[LengthData{ firstNumberIndex, lastNumberIndex - firstNumberIndex }]));
-			other.erase(static_cast<std::string_view>(other).find("\r\n"));
-			static_cast<HttpsConnection*>(this)->data.currentState = HttpsState::Collecting_Headers;
-			return static_cast<std::string_view>(other).find("\r\n");
-		} else if (static_cast<std::string_view>(other).size() > 200 &&
-			static_cast<std::string_view>(other).find("HTTP/1.") == std::string::npos) {
-			static_cast<HttpsConnection*>(this)->data.responseCode = 200;
-			static_cast<HttpsConnection*>(this)->data.currentState = HttpsState::Collecting_Contents;
-			return 0;
+			data.currentState = HttpsState::Collecting_Headers;
+		} else {
+			data.currentState = HttpsState::Complete;
 		}
-		return 0;
+		this->clearLine();
 	}
 
-	void HttpsRnRBuilder::clearCRLF(StringBuffer& other) {
-		uint64_t count{};
-		for (uint64_t x = 0; x < other.size(); ++x) {
-			if (isspace(static_cast<uint8_t>(other[x])) != 0) {
-				++count;
+	void HttpsRnRBuilder::finalizeHeaders() {
+		auto& connection = *static_cast<HttpsConnection*>(this);
+		for (auto& value: this->headerSpans) {
+			connection.data.responseHeaders[std::string{ connection.inputBufferReal[value.key] }] =
+				std::string{ connection.inputBufferReal[value.value] };
+		}
+		this->headerSpans.clear();
+		this->clearLine();
+		uint32_t responseCode{ connection.data.responseCode };
+		if (responseCode == 204 || responseCode == 304 || (responseCode >= 100 && responseCode < 200)) {
+			connection.data.currentState = HttpsState::Complete;
+		} else if (this->isItChunked) {
+			connection.data.contentLength = 0;
+			connection.data.currentState = HttpsState::Collecting_Size;
+		} else if (this->doWeHaveContentSize) {
+			if (connection.data.contentLength == 0) {
+				connection.data.currentState = HttpsState::Complete;
 			} else {
-				break;
+				connection.data.responseData.reserve(connection.data.contentLength + simdjson::SIMDJSON_PADDING);
+				this->remainingChunkSize = connection.data.contentLength;
+				connection.data.currentState = HttpsState::Collecting_Contents;
 			}
+		} else {
+			this->remainingChunkSize = std::numeric_limits<uint64_t>::max();
+			connection.data.currentState = HttpsState::Collecting_Contents;
 		}
-		other.erase(count);
+	}
+
+	void HttpsRnRBuilder::clearLine() {
+		static_cast<HttpsConnection*>(this)->inputBufferReal.clear();
+		this->lineOffset = 0;
 	}
 
 	HttpsConnection::HttpsConnection(bool doWePrintErrorMessages) : HttpsRnRBuilder(doWePrintErrorMessages) {
@@ -273,80 +307,49 @@ namespace DiscordCoreInternal {
 	};
 
 	void HttpsConnection::handleBuffer() noexcept {
-		DiscordCoreAPI::StopWatch stopWatch{ 500ms };
-		stopWatch.resetTimer();
-		while (true) {
-			switch (this->data.currentState) {
-				case HttpsState::Collecting_Code: {
-					if (stopWatch.hasTimePassed()) {
-						this->areWeDoneTheRequest = true;
-						return;
-					}
-					auto stringView = this->getInputBuffer();
-					if (stringView.size() > 0) {
-						this->inputBufferReal.writeData(stringView.data(), stringView.size());
-					}
-					this->parseCode(this->inputBufferReal);
-					if (this->data.responseCode == 400) {
-					}
-					stopWatch.resetTimer();
-					if (this->data.responseCode == 204) {
-						this->areWeDoneTheRequest = true;
-						return;
-					}
-					return;
-				}
-				case HttpsState::Collecting_Headers: {
-					if (stopWatch.hasTimePassed()) {
-						this->areWeDoneTheRequest = true;
-						return;
-					}
-					if (!this->doWeHaveHeaders) {
-						auto stringView = this->getInputBuffer();
-						if (stringView.size() > 0) {
-							this->inputBufferReal.writeData(stringView.data(), stringView.size());
-						}
-						this->parseHeaders(this->inputBufferReal);
-						stopWatch.resetTimer();
-					}
-					return;
+		auto stringView = this->getInputBuffer();
+		while (stringView.size() > 0) {
+			if (this->parseData(stringView)) {
+				this->areWeDoneTheRequest = true;
+			}
+			stringView = this->getInputBuffer();
+		}
+	}
+
+	ProcessIOResult HttpsConnection::writeStreamingRequest(std::string_view request, const HttpsWorkloadData& workload,
+		int32_t msToWait) {
+		std::string stagingBuffer{};
+		stagingBuffer.reserve(this->maxBufferSize);
+		stagingBuffer.append(request);
+		uint64_t bytesWritten{};
+		for (auto& value: workload.bodySources) {
+			value->rewind();
+			for (auto piece = value->readData(); piece.size() > 0; piece = value->readData()) {
+				bytesWritten += piece.size();
+				if (stagingBuffer.size() + piece.size() <= this->maxBufferSize) {
+					stagingBuffer.append(piece);
+					continue;
 				}
-				case HttpsState::Collecting_Size: {
-					if (stopWatch.hasTimePassed()) {
-						this->areWeDoneTheRequest = true;
-						return;
-					}
-					if (!this->doWeHaveContentSize) {
-						auto stringView = this->getInputBuffer();
-						if (stringView.size() > 0) {
-							this->inputBufferReal.writeData(stringView.data(), stringView.size());
-						}
-						this->clearCRLF(this->inputBufferReal);
-						this->parseSize(this->inputBufferReal);
-						this->clearCRLF(this->inputBufferReal);
-						stopWatch.resetTimer();
+				if (stagingBuffer.size() > 0) {
+					if (this->writeDataBlocking(stagingBuffer, msToWait) == ProcessIOResult::Error) {
+						return ProcessIOResult::Error;
 					}
-					return;
+					stagingBuffer.clear();
 				}
-				case HttpsState::Collecting_Contents: {
-					auto stringView = this->getInputBuffer();
-					if (stringView.size() > 0) {
-						this->inputBufferReal.writeData(stringView.data(), stringView.size());
-					}
-					auto result = this->parseChunk(this->inputBufferReal);
-					if ((this->data.responseData.size() >= this->data.contentLength && !result) || stopWatch.hasTimePassed() || !result ||
-						(this->data.responseCode == -5 && this->data.contentLength == -5)) {
-						this->areWeDoneTheRequest = true;
-						return;
-					} else {
-						stopWatch.resetTimer();
-					}
-					return;
+				if (piece.size() < this->maxBufferSize) {
+					stagingBuffer.append(piece);
+				} else if (this->writeDataBlocking(piece, msToWait) == ProcessIOResult::Error) {
+					return ProcessIOResult::Error;
 				}
 			}
-			std::this_thread::sleep_for(1ms);
 		}
-		return;
+		if (stagingBuffer.size() > 0 && this->writeDataBlocking(stagingBuffer, msToWait) == ProcessIOResult::Error) {
+			return ProcessIOResult::Error;
+		}
+		if (bytesWritten != workload.getBodySize()) {
+			return ProcessIOResult::Error;
+		}
+		return ProcessIOResult::No_Error;
 	}
 
 	void HttpsConnection::disconnect() noexcept {
@@ -365,8 +368,9 @@ namespace DiscordCoreInternal {
 		this->doWeHaveContentSize = false;
 		this->areWeDoneTheRequest = false;
 		SSLDataInterface::bytesRead = 0;
-		this->doWeHaveHeaders = false;
-		this->isItChunked = false;
+		this->headerSpans.clear();
+		this->remainingChunkSize = 0;
+		this->lineOffset = 0;
 	}
 
 	HttpsConnectionManager::HttpsConnectionManager(DiscordCoreAPI::ConfigManager* configManagerNew) {
@@ -424,7 +428,8 @@ namespace DiscordCoreInternal {
 		auto returnData = this->httpsRequest(httpsConnection, workload);
 		if (returnData.responseCode != 200 && returnData.responseCode != 204 && returnData.responseCode != 201) {
 			std::string errorMessage{ DiscordCoreAPI::shiftToBrightRed() + workload.callStack + "Https Error: " +
-				static_cast<std::string>(returnData.responseCode) + "\nThe Request: " + workload.content + DiscordCoreAPI::reset() + "" };
+				static_cast<std::string>(returnData.responseCode) + "\nThe Request: " + workload.getContentSummary() +
+				DiscordCoreAPI::reset() + "" };
 			HttpsError theError{ errorMessage };
 			theError.errorCode = returnData.responseCode;
 			httpsConnection->areWeCheckedOut.store(false);
@@ -443,8 +448,8 @@ namespace DiscordCoreInternal {
 			if (workloadNew.callStack != "") {
 				errorMessage += workloadNew.callStack + " ";
 			}
-			errorMessage += "Https Error: " + static_cast<std::string>(returnData.responseCode) + "\nThe Request: " + workloadNew.content +
-				DiscordCoreAPI::reset();
+			errorMessage += "Https Error: " + static_cast<std::string>(returnData.responseCode) +
+				"\nThe Request: " + workloadNew.getContentSummary() + DiscordCoreAPI::reset();
 			HttpsError theError{ errorMessage };
 			theError.errorCode = returnData.responseCode;
 			connection->areWeCheckedOut.store(false);
@@ -473,22 +478,99 @@ namespace DiscordCoreInternal {
 		}
 		rateLimitData.theSemaphore.release();
 
-		while (HttpsWorkloadData::workloadIdsInternal[workload.workloadType]->load() < workload.thisWorkerId.load() &&
-			workload.thisWorkerId.load() != 0) {
-			std::this_thread::sleep_for(1ms);
+		std::string requestKey{};
+		std::promise<HttpsResponseData> promise{};
+		std::optional<HttpsResponseData> cachedResponse{};
+		std::shared_future<HttpsResponseData> inFlightRequest{};
+		if (workload.workloadClass == HttpsWorkloadClass::Get) {
+			requestKey = "GET " + workload.baseUrl + workload.relativePath;
+			Milliseconds currentTime = std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch());
+			Milliseconds timeToLive{ this->configManager->getHttpsResponseTtlInMs() };
+			std::unique_lock lock{ this->inFlightMutex };
+			if (this->cachedResponses.contains(requestKey) && currentTime - this->cachedResponses[requestKey].storedTime < timeToLive) {
+				cachedResponse = this->cachedResponses[requestKey].data;
+			} else if (this->inFlightRequests.contains(requestKey)) {
+				inFlightRequest = this->inFlightRequests[requestKey];
+			} else {
+				this->inFlightRequests[requestKey] = promise.get_future().share();
+			}
 		}
+		if (cachedResponse || inFlightRequest.valid()) {
+			this->waitForWorkloadTurn(workload);
+			auto value = HttpsWorkloadData::workloadIdsInternal[workload.workloadType]->load();
+			HttpsWorkloadData::workloadIdsInternal[workload.workloadType]->store(value + 1);
+			return cachedResponse ? std::move(*cachedResponse) : inFlightRequest.get();
+		}
+
+		this->waitForWorkloadTurn(workload);
 
 		while (!rateLimitData.theSemaphore.try_acquire()) {
 			std::this_thread::sleep_for(1ms);
 		}
 
+		HttpsRequestGuard requestGuard{ this, &rateLimitData, &workload, &requestKey, &promise };
+
 		HttpsResponseData resultData = this->executeByRateLimitData(httpsConnection, workload, rateLimitData);
-		auto value = HttpsWorkloadData::workloadIdsInternal[workload.workloadType]->load();
-		HttpsWorkloadData::workloadIdsInternal[workload.workloadType]->store(value + 1);
-		rateLimitData.theSemaphore.release();
+		requestGuard.publish(resultData);
 		return resultData;
 	}
 
+	HttpsRequestGuard::HttpsRequestGuard(HttpsClient* clientNew, RateLimitData* rateLimitDataNew, const HttpsWorkloadData* workloadNew,
+		const std::string* requestKeyNew, std::promise<HttpsResponseData>* promiseNew) noexcept {
+		this->rateLimitData = rateLimitDataNew;
+		this->requestKey = requestKeyNew;
+		this->workload = workloadNew;
+		this->promise = promiseNew;
+		this->client = clientNew;
+	}
+
+	void HttpsRequestGuard::publish(HttpsResponseData& resultData) {
+		if (*this->requestKey != "") {
+			Milliseconds currentTime = std::chrono::duration_cast<Milliseconds>(HRClock::now().time_since_epoch());
+			Milliseconds timeToLive{ this->client->configManager->getHttpsResponseTtlInMs() };
+			std::unique_lock lock{ this->client->inFlightMutex };
+			std::erase_if(this->client->cachedResponses, [&](auto& value) {
+				return currentTime - value.second.storedTime >= timeToLive;
+			});
+			if (timeToLive.count() > 0 && resultData.responseCode == 200) {
+				this->client->cachedResponses[*this->requestKey] = HttpsCachedResponse{ currentTime, resultData };
+			}
+			this->client->inFlightRequests.erase(*this->requestKey);
+			lock.unlock();
+			this->promise->set_value(resultData);
+		}
+		this->isItPublished = true;
+	}
+
+	HttpsRequestGuard::~HttpsRequestGuard() noexcept {
+		if (!this->isItPublished && *this->requestKey != "") {
+			std::unique_lock lock{ this->client->inFlightMutex };
+			this->client->inFlightRequests.erase(*this->requestKey);
+			lock.unlock();
+			this->promise->set_exception(std::make_exception_ptr(DiscordCoreAPI::DCAException{ "HttpsClient::httpsRequest() failed." }));
+		}
+		auto value = HttpsWorkloadData::workloadIdsInternal[this->workload->workloadType]->load();
+		HttpsWorkloadData::workloadIdsInternal[this->workload->workloadType]->store(value + 1);
+		this->rateLimitData->theSemaphore.release();
+	}
+
+	int64_t HttpsClient::getRemainingRequests(HttpsWorkloadType workloadType) {
+		auto& rateLimitValueBuckets = this->connectionManager.getRateLimitValueBuckets();
+		auto& rateLimitValues = this->connectionManager.getRateLimitValues();
+		if (rateLimitValueBuckets.contains(workloadType) && rateLimitValues.contains(rateLimitValueBuckets[workloadType]) &&
+			rateLimitValues[rateLimitValueBuckets[workloadType]]) {
+			return rateLimitValues[rateLimitValueBuckets[workloadType]]->getsRemaining.load();
+		}
+		return 0;
+	}
+
+	void HttpsClient::waitForWorkloadTurn(const HttpsWorkloadData& workload) {
+		while (HttpsWorkloadData::workloadIdsInternal[workload.workloadType]->load() < workload.thisWorkerId.load() &&
+			workload.thisWorkerId.load() != 0) {
+			std::this_thread::sleep_for(1ms);
+		}
+	}
+
 	HttpsResponseData HttpsClient::httpsRequestInternal(HttpsConnection* httpsConnection, const HttpsWorkloadData& workload,
 		RateLimitData& rateLimitData) {
 		httpsConnection->resetValues();
@@ -500,7 +582,8 @@ namespace DiscordCoreInternal {
 		if (workload.baseUrl != httpsConnection->currentBaseUrl || !httpsConnection->areWeStillConnected() ||
 			httpsConnection->doWeConnect) {
 			httpsConnection->currentBaseUrl = workload.baseUrl;
-			if (!httpsConnection->connect(workload.baseUrl, 443, this->configManager->doWePrintHttpsErrorMessages(), false)) {
+			if (!httpsConnection->connect(workload.baseUrl, 443, this->configManager->doWePrintHttpsErrorMessages(), false,
+					this->configManager->getHttpsTimeoutOptions().connectTimeoutInMs)) {
 				++httpsConnection->currentReconnectTries;
 				httpsConnection->doWeConnect = true;
 				return this->httpsRequestInternal(httpsConnection, workload, rateLimitData);
@@ -510,12 +593,17 @@ namespace DiscordCoreInternal {
 		auto request = httpsConnection->buildRequest(workload);
 		DiscordCoreAPI::StopWatch stopWatch{ 5000ms };
 		ProcessIOResult result{};
-		do {
-			if (stopWatch.hasTimePassed()) {
-				break;
-			}
-			result = httpsConnection->writeData(request, true);
-		} while (result == ProcessIOResult::Error);
+		if (workload.bodySources.size() > 0) {
+			result = httpsConnection->writeStreamingRequest(request, workload,
+				this->configManager->getHttpsTimeoutOptions().idleTimeoutInMs);
+		} else {
+			do {
+				if (stopWatch.hasTimePassed()) {
+					break;
+				}
+				result = httpsConnection->writeData(request, true);
+			} while (result == ProcessIOResult::Error);
+		}
 		if (result == ProcessIOResult::Error) {
 			++httpsConnection->currentReconnectTries;
 			httpsConnection->doWeConnect = true;
@@ -628,11 +716,35 @@ namespace DiscordCoreInternal {
 	}
 
 	HttpsResponseData HttpsClient::getResponse(HttpsConnection* connection, RateLimitData& rateLimitData) {
-		connection->resetValues();
+		auto timeouts = this->configManager->getHttpsTimeoutOptions();
+		DiscordCoreAPI::StopWatch stopWatch{ Milliseconds{ timeouts.firstByteTimeoutInMs } };
 		ProcessIOResult result{};
-		DiscordCoreAPI::StopWatch stopWatch{ 5000ms };
-		while (!connection->areWeDoneTheRequest && result != ProcessIOResult::Error && !stopWatch.hasTimePassed()) {
-			result = connection->processIO(1000);
+		int64_t bytesRead{};
+		while (!connection->areWeDoneTheRequest) {
+			int64_t msRemaining{ stopWatch.getTotalWaitTime().count() - stopWatch.totalTimePassed().count() };
+			if (msRemaining <= 0) {
+				break;
+			}
+			if (result = connection->processIO(static_cast<int32_t>(msRemaining)); result == ProcessIOResult::Error) {
+				break;
+			}
+			if (connection->getBytesRead() != bytesRead) {
+				if (bytesRead == 0) {
+					stopWatch = DiscordCoreAPI::StopWatch{ Milliseconds{ timeouts.idleTimeoutInMs } };
+				} else {
+					stopWatch.resetTimer();
+				}
+				bytesRead = connection->getBytesRead();
+			}
+		}
+		if (!connection->areWeDoneTheRequest) {
+			connection->doWeConnect = true;
+			bool isItDelimitedByClose{ result == ProcessIOResult::Error &&
+				connection->data.currentState == HttpsState::Collecting_Contents && !connection->isItChunked &&
+				!connection->doWeHaveContentSize };
+			if (!isItDelimitedByClose) {
+				connection->data.responseCode = static_cast<uint32_t>(-1);
+			}
 		}
 		auto data = connection->finalizeReturnValues(rateLimitData);
 		connection->resetValues();
@@ -328,7 +328,7 @@ namespace DiscordCoreAPI {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
 			auto serializer = dataPackage.data.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
-			workload.content = constructMultiPartData(serializer.operator std::string(), dataPackage.data.data.files);
+			workload.setMultiPartContent(serializer.operator std::string(), dataPackage.data.data.files);
 		} else {
 			auto serializer = dataPackage.data.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
@@ -366,7 +366,7 @@ namespace DiscordCoreAPI {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
 			auto serializer = dataPackage.data.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
-			workload.content = constructMultiPartData(serializer.operator std::string(), dataPackage.data.files);
+			workload.setMultiPartContent(serializer.operator std::string(), dataPackage.data.files);
 		} else {
 			auto serializer = dataPackage.data.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
@@ -398,7 +398,7 @@ namespace DiscordCoreAPI {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
 			auto serializer = dataPackage.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
-			workload.content = constructMultiPartData(serializer.operator std::string(), dataPackage.files);
+			workload.setMultiPartContent(serializer.operator std::string(), dataPackage.files);
 		} else {
 			auto serializer = dataPackage.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
@@ -430,7 +430,7 @@ namespace DiscordCoreAPI {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
 			auto serializer = dataPackage.data.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
-			workload.content = constructMultiPartData(serializer.operator std::string(), dataPackage.data.files);
+			workload.setMultiPartContent(serializer.operator std::string(), dataPackage.data.files);
 		} else {
 			auto serializer = dataPackage.data.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
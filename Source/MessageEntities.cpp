@@ -378,6 +378,36 @@ namespace DiscordCoreAPI {
 		co_return Messages::httpsClient->submitWorkloadAndGetResult<MessageVector>(workload, &returnValue);
 	}
 
+	PageIterator<Message, GetMessagesData> Messages::iterateMessages(GetMessagesData dataPackage) {
+		if (dataPackage.limit <= 0 || dataPackage.limit > 100) {
+			dataPackage.limit = 100;
+		}
+		auto collectFunction = [](GetMessagesData dataPackage) {
+			return Messages::getMessagesAsync(dataPackage).get();
+		};
+		auto advanceFunction = [](GetMessagesData& dataPackage, std::vector<Message>& page) {
+			if (dataPackage.aroundThisId != 0 || page.size() < static_cast<uint64_t>(dataPackage.limit)) {
+				return false;
+			}
+			uint64_t lowestId{ std::numeric_limits<uint64_t>::max() };
+			uint64_t highestId{};
+			for (auto& value: page) {
+				lowestId = std::min(lowestId, static_cast<uint64_t>(value.id));
+				highestId = std::max(highestId, static_cast<uint64_t>(value.id));
+			}
+			if (dataPackage.afterThisId != 0) {
+				dataPackage.afterThisId = highestId;
+			} else {
+				dataPackage.beforeThisId = lowestId;
+			}
+			return true;
+		};
+		auto budgetFunction = [] {
+			return Messages::httpsClient->getRemainingRequests(DiscordCoreInternal::HttpsWorkloadType::Get_Messages) > 1;
+		};
+		return PageIterator<Message, GetMessagesData>{ dataPackage, collectFunction, advanceFunction, budgetFunction };
+	}
+
 	CoRoutine<Message> Messages::getMessageAsync(GetMessageData dataPackage) {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Message };
 		co_await NewThreadAwaitable<Message>();
@@ -397,7 +427,7 @@ namespace DiscordCoreAPI {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
 			auto serializer = dataPackage.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
-			workload.content = constructMultiPartData(serializer.operator std::string(), dataPackage.files);
+			workload.setMultiPartContent(serializer.operator std::string(), dataPackage.files);
 		} else {
 			auto serializer = dataPackage.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
@@ -427,7 +457,7 @@ namespace DiscordCoreAPI {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
 			auto serializer = dataPackage.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
-			workload.content = constructMultiPartData(serializer.operator std::string(), dataPackage.files);
+			workload.setMultiPartContent(serializer.operator std::string(), dataPackage.files);
 		} else {
 			auto serializer = dataPackage.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
@@ -475,6 +505,44 @@ namespace DiscordCoreAPI {
 		co_return Messages::httpsClient->submitWorkloadAndGetResult<void>(workload);
 	}
 
+	CoRoutine<void> Messages::deleteMessagesInBatchesAsync(DeleteMessagesBulkData dataPackage) {
+		co_await NewThreadAwaitable<void>();
+		constexpr uint64_t discordEpochInMs{ 1420070400000 };
+		constexpr uint64_t fourteenDaysInMs{ 14ull * 24ull * 60ull * 60ull * 1000ull };
+		uint64_t currentTimeInMs = std::chrono::duration_cast<Milliseconds>(SysClock::now().time_since_epoch()).count();
+		std::vector<Snowflake> recentIds{};
+		for (auto& value: dataPackage.messageIds) {
+			uint64_t createdAtInMs = (static_cast<uint64_t>(value) >> 22) + discordEpochInMs;
+			if (currentTimeInMs - createdAtInMs < fourteenDaysInMs) {
+				recentIds.emplace_back(value);
+				continue;
+			}
+			DeleteMessageData dataPackageNew{};
+			dataPackageNew.timeStamp = TimeStamp{ createdAtInMs, TimeFormat::LongDateTime };
+			dataPackageNew.channelId = dataPackage.channelId;
+			dataPackageNew.reason = dataPackage.reason;
+			dataPackageNew.messageId = value;
+			Messages::deleteMessageAsync(dataPackageNew).get();
+		}
+		for (uint64_t x = 0; x < recentIds.size(); x += 100) {
+			uint64_t batchSize = std::min<uint64_t>(100, recentIds.size() - x);
+			if (batchSize == 1) {
+				DeleteMessageData dataPackageNew{};
+				dataPackageNew.channelId = dataPackage.channelId;
+				dataPackageNew.reason = dataPackage.reason;
+				dataPackageNew.messageId = recentIds[x];
+				Messages::deleteMessageAsync(dataPackageNew).get();
+			} else {
+				DeleteMessagesBulkData dataPackageNew{};
+				dataPackageNew.messageIds.assign(recentIds.begin() + x, recentIds.begin() + x + batchSize);
+				dataPackageNew.channelId = dataPackage.channelId;
+				dataPackageNew.reason = dataPackage.reason;
+				Messages::deleteMessagesBulkAsync(dataPackageNew).get();
+			}
+		}
+		co_return;
+	}
+
 	CoRoutine<std::vector<Message>> Messages::getPinnedMessagesAsync(GetPinnedMessagesData dataPackage) {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_Pinned_Messages };
 		co_await NewThreadAwaitable<std::vector<Message>>();
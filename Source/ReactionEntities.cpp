@@ -161,6 +161,30 @@ namespace DiscordCoreAPI {
 		co_return Reactions::httpsClient->submitWorkloadAndGetResult<UserVector>(workload, &returnValue);
 	}
 
+	PageIterator<User, GetReactionsData> Reactions::iterateReactions(GetReactionsData dataPackage) {
+		if (dataPackage.limit <= 0 || dataPackage.limit > 100) {
+			dataPackage.limit = 100;
+		}
+		auto collectFunction = [](GetReactionsData dataPackage) {
+			return Reactions::getReactionsAsync(dataPackage).get().operator std::vector<User>();
+		};
+		auto advanceFunction = [](GetReactionsData& dataPackage, std::vector<User>& page) {
+			if (page.size() < static_cast<uint64_t>(dataPackage.limit)) {
+				return false;
+			}
+			uint64_t highestId{};
+			for (auto& value: page) {
+				highestId = std::max(highestId, static_cast<uint64_t>(value.id));
+			}
+			dataPackage.afterId = highestId;
+			return true;
+		};
+		auto budgetFunction = [] {
+			return Reactions::httpsClient->getRemainingRequests(DiscordCoreInternal::HttpsWorkloadType::Get_Reactions) > 1;
+		};
+		return PageIterator<User, GetReactionsData>{ dataPackage, collectFunction, advanceFunction, budgetFunction };
+	}
+
 
 	CoRoutine<void> Reactions::deleteAllReactionsAsync(DeleteAllReactionsData dataPackage) {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Delete_All_Reactions };
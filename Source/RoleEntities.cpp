@@ -84,7 +84,7 @@ namespace DiscordCoreAPI {
 
 		this->icon = getString(jsonObjectData, "icon");
 
-		this->name = getString(jsonObjectData, "name");
+		this->name = StringWrapper::intern(getString(jsonObjectData, "name"));
 
 		std::stringstream stream{};
 		stream << getString(jsonObjectData, "unicode_emoji");
@@ -172,6 +172,7 @@ namespace DiscordCoreAPI {
 
 	void Roles::initialize(DiscordCoreInternal::HttpsClient* client, ConfigManager* configManagerNew) {
 		Roles::doWeCacheRolesBool = configManagerNew->doWeCacheRoles();
+		Roles::cache.setPolicy(configManagerNew->getCacheOptions().rolePolicy);
 		Roles::httpsClient = client;
 	}
 
@@ -294,8 +295,8 @@ namespace DiscordCoreAPI {
 		}
 		Role data{};
 		data = Roles::httpsClient->submitWorkloadAndGetResult<Role>(workload, &data);
-		if (Roles::cache.contains(data)) {
-			data = Roles::cache.at(data);
+		if (auto cachedRole = Roles::cache.find(data.id)) {
+			data = *cachedRole;
 		} else {
 			Roles::insertRole(data);
 		}
@@ -344,26 +345,28 @@ namespace DiscordCoreAPI {
 	}
 
 	RoleData Roles::getCachedRole(GetRoleData dataPackage) {
-		RoleData data{};
-		data.id = dataPackage.roleId;
-		if (!Roles::cache.contains(data)) {
-			return Roles::getRoleAsync(dataPackage).get();
+		if (auto cachedRole = Roles::cache.find(dataPackage.roleId)) {
+			return *cachedRole;
 		} else {
-			data = Roles::cache.at(data);
-			return data;
+			return Roles::getRoleAsync(dataPackage).get();
 		}
 	}
+
+	std::shared_ptr<const RoleData> Roles::getCachedRoleView(GetRoleData dataPackage) {
+		return Roles::cache.find(dataPackage.roleId);
+	}
+
+	ObjectCache<RoleData>& Roles::getCache() {
+		return Roles::cache;
+	}
+
 	StopWatch<Milliseconds> stopWatchNew{ 5ms };
 	void Roles::insertRole(RoleData role) {
 		if (role.id == 0) {
 			return;
 		}
 		if (Roles::doWeCacheRoles()) {
-			if (!Roles::cache.contains(role)) {
-				Roles::cache.emplace(std::move(role));
-			} else {
-				Roles::cache[role] = std::move(role);
-			}
+			Roles::cache.emplace(std::move(role));
 			if (Roles::cache.size() % 10000 == 0) {
 				std::cout << "ROLE COUNT: " << Roles::cache.size() << ", AFTER: " << stopWatchNew.totalTimePassed().count() << "s"
 						  << std::endl;
@@ -372,9 +375,7 @@ namespace DiscordCoreAPI {
 	}
 
 	void Roles::removeRole(const Snowflake roleId) {
-		RoleData data{};
-		data.id = roleId;
-		Roles::cache.erase(data);
+		Roles::cache.erase(roleId);
 	};
 
 	bool Roles::doWeCacheRoles() {
@@ -26,6 +26,16 @@
 #include <discordcoreapi/SSLClients.hpp>
 #include <discordcoreapi/WebSocketEntities.hpp>
 
+#ifdef __linux__
+	#include <netinet/udp.h>
+	#ifndef SOL_UDP
+		#define SOL_UDP 17
+	#endif
+	#ifndef UDP_SEGMENT
+		#define UDP_SEGMENT 103
+	#endif
+#endif
+
 namespace DiscordCoreInternal {
 
 	std::string reportSSLError(const std::string& errorPosition, int32_t errorValue = 0, SSL* ssl = nullptr) noexcept {
@@ -171,8 +181,8 @@ namespace DiscordCoreInternal {
 		return true;
 	}
 
-	bool TCPSSLClient::connect(const std::string& baseUrl, const uint16_t portNew, bool doWePrintErrorsNew,
-		bool areWeAStandaloneSocketNew) noexcept {
+	bool TCPSSLClient::connect(const std::string& baseUrl, const uint16_t portNew, bool doWePrintErrorsNew, bool areWeAStandaloneSocketNew,
+		int32_t connectTimeoutInMs) noexcept {
 		this->areWeAStandaloneSocket = areWeAStandaloneSocketNew;
 		this->doWePrintErrorMessages = doWePrintErrorsNew;
 		std::string addressString{};
@@ -222,12 +232,43 @@ namespace DiscordCoreInternal {
 			return false;
 		}
 
-		if (::connect(this->socket, address->ai_addr, static_cast<int32_t>(address->ai_addrlen)) == SOCKET_ERROR) {
+#ifdef _WIN32
+		u_long value02{ 1 };
+		if (auto returnValue{ ioctlsocket(this->socket, FIONBIO, &value02) }; returnValue == SOCKET_ERROR) {
+			if (this->doWePrintErrorMessages) {
+				cout << reportError("TCPSSLClient::connect::ioctlsocket(), to: " + baseUrl) << endl;
+			}
+			return false;
+		}
+#else
+		if (auto returnValue{ fcntl(this->socket, F_SETFL, fcntl(this->socket, F_GETFL, 0) | O_NONBLOCK) }; returnValue == SOCKET_ERROR) {
 			if (this->doWePrintErrorMessages) {
-				cout << reportError("TCPSSLClient::connect::connect(), to: " + baseUrl) << endl;
+				cout << reportError("TCPSSLClient::connect::fcntl(), to: " + baseUrl) << endl;
 			}
 			return false;
 		}
+#endif
+
+		DiscordCoreAPI::StopWatch stopWatch{ Milliseconds{ connectTimeoutInMs } };
+		if (::connect(this->socket, address->ai_addr, static_cast<int32_t>(address->ai_addrlen)) == SOCKET_ERROR) {
+			if (errno != EWOULDBLOCK && errno != EINPROGRESS) {
+				if (this->doWePrintErrorMessages) {
+					cout << reportError("TCPSSLClient::connect::connect(), to: " + baseUrl) << endl;
+				}
+				return false;
+			}
+			pollfd writeSet{ .fd = static_cast<SOCKET>(this->socket), .events = POLLOUT, .revents = 0 };
+			int32_t errorValue{};
+			socklen_t errorSize{ sizeof(errorValue) };
+			if (poll(&writeSet, 1, connectTimeoutInMs) <= 0 ||
+				getsockopt(this->socket, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&errorValue), &errorSize) == SOCKET_ERROR ||
+				errorValue != 0) {
+				if (this->doWePrintErrorMessages) {
+					cout << reportError("TCPSSLClient::connect::connect(), to: " + baseUrl) << endl;
+				}
+				return false;
+			}
+		}
 
 		std::unique_lock lock{ SSLConnectionInterface::mutex };
 		if (this->ssl = SSL_new(this->context); !this->ssl) {
@@ -253,29 +294,29 @@ namespace DiscordCoreInternal {
 			return false;
 		}
 
-		if (auto result{ SSL_connect(this->ssl) }; result != 1) {
-			if (this->doWePrintErrorMessages) {
-				cout << reportSSLError("TCPSSLClient::connect::SSL_connect(), to: " + baseUrl, result, this->ssl) << endl;
+		while (true) {
+			auto result{ SSL_connect(this->ssl) };
+			if (result == 1) {
+				break;
 			}
-			return false;
-		}
-
-#ifdef _WIN32
-		u_long value02{ 1 };
-		if (auto returnValue{ ioctlsocket(this->socket, FIONBIO, &value02) }; returnValue == SOCKET_ERROR) {
-			if (this->doWePrintErrorMessages) {
-				cout << reportError("TCPSSLClient::connect::ioctlsocket(), to: " + baseUrl) << endl;
+			auto errorValue{ SSL_get_error(this->ssl, result) };
+			int64_t msRemaining{ connectTimeoutInMs - stopWatch.totalTimePassed().count() };
+			if ((errorValue != SSL_ERROR_WANT_READ && errorValue != SSL_ERROR_WANT_WRITE) || msRemaining <= 0) {
+				if (this->doWePrintErrorMessages) {
+					cout << reportSSLError("TCPSSLClient::connect::SSL_connect(), to: " + baseUrl, result, this->ssl) << endl;
+				}
+				return false;
 			}
-			return false;
-		}
-#else
-		if (auto returnValue{ fcntl(this->socket, F_SETFL, fcntl(this->socket, F_GETFL, 0) | O_NONBLOCK) }; returnValue == SOCKET_ERROR) {
-			if (this->doWePrintErrorMessages) {
-				cout << reportError("TCPSSLClient::connect::ioctlsocket(), to: " + baseUrl) << endl;
+			pollfd readWriteSet{ .fd = static_cast<SOCKET>(this->socket), .events = 0, .revents = 0 };
+			readWriteSet.events = errorValue == SSL_ERROR_WANT_READ ? POLLIN : POLLOUT;
+			if (poll(&readWriteSet, 1, static_cast<int32_t>(msRemaining)) == SOCKET_ERROR) {
+				if (this->doWePrintErrorMessages) {
+					cout << reportError("TCPSSLClient::connect::poll(), to: " + baseUrl) << endl;
+				}
+				return false;
 			}
-			return false;
 		}
-#endif
+
 		return true;
 	}
 
@@ -367,6 +408,36 @@ namespace DiscordCoreInternal {
 		}
 	}
 
+	ProcessIOResult TCPSSLClient::writeDataBlocking(std::string_view dataToWrite, int32_t msToWait) noexcept {
+		while (dataToWrite.size() > 0) {
+			if (!this->areWeStillConnected()) {
+				return ProcessIOResult::Error;
+			}
+			uint64_t writtenBytes{};
+			auto returnValue{ SSL_write_ex(this->ssl, dataToWrite.data(), dataToWrite.size(), &writtenBytes) };
+			if (returnValue == 1) {
+				dataToWrite.remove_prefix(writtenBytes);
+				continue;
+			}
+			auto errorValue{ SSL_get_error(this->ssl, returnValue) };
+			if (errorValue != SSL_ERROR_WANT_READ && errorValue != SSL_ERROR_WANT_WRITE) {
+				if (this->doWePrintErrorMessages) {
+					cout << reportSSLError("TCPSSLClient::writeDataBlocking()", errorValue, this->ssl) << endl;
+				}
+				return ProcessIOResult::Error;
+			}
+			pollfd readWriteSet{ .fd = static_cast<SOCKET>(this->socket), .events = 0, .revents = 0 };
+			readWriteSet.events = errorValue == SSL_ERROR_WANT_READ ? POLLIN : POLLOUT;
+			if (poll(&readWriteSet, 1, msToWait) <= 0) {
+				if (this->doWePrintErrorMessages) {
+					cout << reportError("TCPSSLClient::writeDataBlocking()") << endl;
+				}
+				return ProcessIOResult::Error;
+			}
+		}
+		return ProcessIOResult::No_Error;
+	}
+
 	ProcessIOResult TCPSSLClient::processIO(int32_t waitTimeInMs) noexcept {
 		pollfd readWriteSet{ .fd = static_cast<SOCKET>(this->socket) };
 		if (this->outputBuffer.getUsedSpace() > 0) {
@@ -541,7 +612,7 @@ namespace DiscordCoreInternal {
 #else
 		if (fcntl(this->socket, F_SETFL, fcntl(this->socket, F_GETFL, 0) | O_NONBLOCK)) {
 			if (this->doWePrintErrors) {
-				cout << reportError("UDPConnection::connect::ioctlsocket(), to: " + baseUrlNew) << endl;
+				cout << reportError("UDPConnection::connect::fcntl(), to: " + baseUrlNew) << endl;
 			}
 			return false;
 		}
@@ -618,6 +689,21 @@ namespace DiscordCoreInternal {
 		if (this->socket == INVALID_SOCKET) {
 			return ProcessIOResult::No_Error;
 		}
+		if (this->streamType == DiscordCoreAPI::StreamType::None) {
+			if (type != ProcessIOType::Read_Only && !this->processWriteDataBatched()) {
+				if (this->doWePrintErrors) {
+					cout << reportError("UDPConnection::processIO::processWriteDataBatched()") << endl;
+				}
+				return ProcessIOResult::Error;
+			}
+			if (type != ProcessIOType::Write_Only && !this->processReadDataBatched()) {
+				if (this->doWePrintErrors) {
+					cout << reportError("UDPConnection::processIO::processReadDataBatched()") << endl;
+				}
+				return ProcessIOResult::Error;
+			}
+			return ProcessIOResult::No_Error;
+		}
 		pollfd readWriteSet{};
 		readWriteSet.fd = this->socket;
 		if (type == ProcessIOType::Both && this->outputBuffer.getUsedSpace() > 0) {
@@ -725,6 +811,124 @@ namespace DiscordCoreInternal {
 		return true;
 	}
 
+	bool UDPConnection::processWriteDataBatched() noexcept {
+#ifdef __linux__
+		std::basic_string_view<std::byte> packets[maxBatchSize]{};
+		uint64_t packetCount{};
+		while (packetCount < maxBatchSize) {
+			packets[packetCount] = this->outputBuffer.readData();
+			if (packets[packetCount].size() == 0) {
+				break;
+			}
+			++packetCount;
+		}
+		if (packetCount == 0) {
+			return true;
+		}
+		if (packetCount > 1 && this->isItGsoCapable && this->sendSegmented(packets, packetCount)) {
+			return true;
+		}
+		mmsghdr messages[maxBatchSize]{};
+		iovec vectors[maxBatchSize]{};
+		for (uint64_t x = 0; x < packetCount; ++x) {
+			vectors[x].iov_base = const_cast<std::byte*>(packets[x].data());
+			vectors[x].iov_len = packets[x].size();
+			messages[x].msg_hdr.msg_iov = &vectors[x];
+			messages[x].msg_hdr.msg_iovlen = 1;
+		}
+		uint64_t packetsSent{};
+		while (packetsSent < packetCount) {
+			int32_t result{ sendmmsg(this->socket, messages + packetsSent, static_cast<uint32_t>(packetCount - packetsSent), 0) };
+			if (result < 0) {
+				return errno == EWOULDBLOCK || errno == EINTR;
+			}
+			packetsSent += static_cast<uint64_t>(result);
+		}
+		return true;
+#else
+		while (this->outputBuffer.getUsedSpace() > 0) {
+			if (!this->processWriteData()) {
+				return false;
+			}
+		}
+		return true;
+#endif
+	}
+
+	bool UDPConnection::sendSegmented(std::basic_string_view<std::byte>* packets, uint64_t packetCount) noexcept {
+#ifdef __linux__
+		const uint64_t segmentSize{ packets[0].size() };
+		uint64_t totalSize{};
+		iovec vectors[maxBatchSize]{};
+		for (uint64_t x = 0; x < packetCount; ++x) {
+			if (packets[x].size() > segmentSize || (packets[x].size() != segmentSize && x != packetCount - 1)) {
+				return false;
+			}
+			vectors[x].iov_base = const_cast<std::byte*>(packets[x].data());
+			vectors[x].iov_len = packets[x].size();
+			totalSize += packets[x].size();
+		}
+		if (totalSize > std::numeric_limits<uint16_t>::max() - 64) {
+			return false;
+		}
+		char control[CMSG_SPACE(sizeof(uint16_t))]{};
+		msghdr message{};
+		message.msg_iov = vectors;
+		message.msg_iovlen = packetCount;
+		message.msg_control = control;
+		message.msg_controllen = sizeof(control);
+		cmsghdr* controlMessage{ CMSG_FIRSTHDR(&message) };
+		controlMessage->cmsg_level = SOL_UDP;
+		controlMessage->cmsg_type = UDP_SEGMENT;
+		controlMessage->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+		const uint16_t segmentSizeValue{ static_cast<uint16_t>(segmentSize) };
+		std::memcpy(CMSG_DATA(controlMessage), &segmentSizeValue, sizeof(uint16_t));
+		if (sendmsg(this->socket, &message, 0) >= 0) {
+			return true;
+		}
+		if (errno != EWOULDBLOCK && errno != EINTR) {
+			this->isItGsoCapable = false;
+		}
+		return false;
+#else
+		return false;
+#endif
+	}
+
+	bool UDPConnection::processReadDataBatched() noexcept {
+#ifdef __linux__
+		while (true) {
+			const uint64_t freeSlices{ std::min(this->inputBuffer.getFreeSpace(), maxBatchSize) };
+			if (freeSlices == 0) {
+				return true;
+			}
+			mmsghdr messages[maxBatchSize]{};
+			iovec vectors[maxBatchSize]{};
+			for (uint64_t x = 0; x < freeSlices; ++x) {
+				vectors[x].iov_base = this->inputBuffer.getSliceAhead(x)->getCurrentHead();
+				vectors[x].iov_len = this->maxBufferSize;
+				messages[x].msg_hdr.msg_iov = &vectors[x];
+				messages[x].msg_hdr.msg_iovlen = 1;
+			}
+			int32_t result{ recvmmsg(this->socket, messages, static_cast<uint32_t>(freeSlices), MSG_DONTWAIT, nullptr) };
+			if (result < 0) {
+				return errno == EWOULDBLOCK || errno == EINTR;
+			}
+			for (int32_t x = 0; x < result; ++x) {
+				this->inputBuffer.getCurrentHead()->modifyReadOrWritePosition(RingBufferAccessType::Write, messages[x].msg_len);
+				this->inputBuffer.modifyReadOrWritePosition(RingBufferAccessType::Write, 1);
+				this->bytesRead += messages[x].msg_len;
+				this->handleAudioBuffer();
+			}
+			if (static_cast<uint64_t>(result) < freeSlices) {
+				return true;
+			}
+		}
+#else
+		return this->processReadData();
+#endif
+	}
+
 	void UDPConnection::disconnect() noexcept {
 		if (this->streamType != DiscordCoreAPI::StreamType ::None) {
 			this->outputBuffer.clear();
@@ -252,6 +252,15 @@ namespace DiscordCoreAPI {
 
 	void SongAPI::sendNextSongFinal(const GuildMember& guildMember) {
 		DiscordCoreClient::getSongAPI(guildMember.guildId)->cancelCurrentSong();
+		DiscordCoreInternal::AudioCache* audioCache = DiscordCoreClient::getAudioCache(guildMember.guildId);
+		Song currentSong = DiscordCoreClient::getSongAPI(guildMember.guildId)->playlist.currentSong;
+		if (auto cacheReader = audioCache ? audioCache->openReader(currentSong) : nullptr) {
+			DiscordCoreClient::getSongAPI(this->guildId)->taskThread =
+				std::make_unique<std::jthread>([=, this, cacheReader = std::move(cacheReader)](std::stop_token eventToken) {
+					this->streamFromCache(*cacheReader, currentSong, eventToken);
+				});
+			return;
+		}
 		if (DiscordCoreClient::getSongAPI(guildMember.guildId)->playlist.currentSong.type == SongType::SoundCloud) {
 			Song newerSong = DiscordCoreClient::getSoundCloudAPI(guildMember.guildId)
 								 ->collectFinalSong(DiscordCoreClient::getSongAPI(guildMember.guildId)->playlist.currentSong);
@@ -270,6 +279,36 @@ namespace DiscordCoreAPI {
 		};
 	}
 
+	void SongAPI::streamFromCache(DiscordCoreInternal::AudioCacheReader& cacheReader, Song song, std::stop_token eventToken) {
+		bool haveWeSentFrames{};
+		while (true) {
+			AudioFrameData frameData{};
+			if (!cacheReader.readFrame(frameData, eventToken)) {
+				break;
+			}
+			frameData.guildMemberId = song.addedByUserId.operator size_t();
+			DiscordCoreClient::getSongAPI(this->guildId)->audioDataBuffer.send(std::move(frameData));
+			haveWeSentFrames = true;
+		}
+		if (eventToken.stop_requested()) {
+			return;
+		}
+		if (cacheReader.haveWeFailed() && !haveWeSentFrames) {
+			if (song.type == SongType::SoundCloud) {
+				Song newerSong = DiscordCoreClient::getSoundCloudAPI(this->guildId)->collectFinalSong(song);
+				DiscordCoreClient::getSoundCloudAPI(this->guildId)->downloadAndStreamAudio(newerSong, eventToken, 0);
+			} else {
+				Song newerSong = DiscordCoreClient::getYouTubeAPI(this->guildId)->collectFinalSong(song);
+				DiscordCoreClient::getYouTubeAPI(this->guildId)->downloadAndStreamAudio(newerSong, eventToken, 0);
+			}
+			return;
+		}
+		AudioFrameData frameData{};
+		frameData.type = AudioFrameType::Skip;
+		frameData.currentSize = 0;
+		DiscordCoreClient::getSongAPI(this->guildId)->audioDataBuffer.send(std::move(frameData));
+	}
+
 	bool SongAPI::sendNextSong(const GuildMember& guildMember) {
 		std::unique_lock accessLock{ SongAPI::accessMutex };
 		DiscordCoreClient::getSongAPI(guildMember.guildId)->sendNextSong();
@@ -233,6 +233,8 @@ namespace DiscordCoreInternal {
 
 	void SoundCloudAPI::downloadAndStreamAudio(const DiscordCoreAPI::Song& newSong, std::stop_token token, int32_t currentReconnectTries) {
 		try {
+			AudioCache* audioCache = DiscordCoreAPI::DiscordCoreClient::getAudioCache(this->guildId);
+			std::unique_ptr<AudioCacheWriter> cacheWriter{ audioCache ? audioCache->beginWrite(newSong) : nullptr };
 			int32_t counter{};
 			BuildAudioDecoderData dataPackage{};
 			dataPackage.totalFileSize = static_cast<uint64_t>(newSong.contentLength);
@@ -313,6 +315,9 @@ namespace DiscordCoreInternal {
 				} else {
 					for (auto& value: frames) {
 						value.guildMemberId = static_cast<DiscordCoreAPI::Song>(newSong).addedByUserId.operator size_t();
+						if (cacheWriter) {
+							cacheWriter->writeFrame(value);
+						}
 						DiscordCoreAPI::DiscordCoreClient::getSongAPI(this->guildId)->audioDataBuffer.send(std::move(value));
 					}
 				}
@@ -327,6 +332,9 @@ namespace DiscordCoreInternal {
 			while (audioDecoder->getFrame(frameData01)) {
 			};
 			audioDecoder.reset(nullptr);
+			if (cacheWriter) {
+				cacheWriter->complete();
+			}
 			DiscordCoreAPI::AudioFrameData frameData{};
 			frameData.type = DiscordCoreAPI::AudioFrameType::Skip;
 			frameData.currentSize = 0;
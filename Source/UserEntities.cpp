@@ -83,7 +83,7 @@ namespace DiscordCoreAPI {
 
 		this->flags = static_cast<UserFlags>(newFlags);
 
-		this->userName = getString(jsonObjectData, "username");
+		this->userName = StringWrapper::intern(getString(jsonObjectData, "username"));
 
 		this->id = getId(jsonObjectData, "id");
 
@@ -160,6 +160,7 @@ namespace DiscordCoreAPI {
 
 	void Users::initialize(DiscordCoreInternal::HttpsClient* client, ConfigManager* configManagerNew) {
 		Users::doWeCacheUsersBool = configManagerNew->doWeCacheUsers();
+		Users::cache.setPolicy(configManagerNew->getCacheOptions().userPolicy);
 		Users::httpsClient = client;
 	}
 
@@ -215,17 +216,17 @@ namespace DiscordCoreAPI {
 	}
 
 	UserData Users::getCachedUser(GetUserData dataPackage) {
-		UserData data{};
-		data.id = dataPackage.userId;
-		if (!Users::cache.contains(*static_cast<UserData*>(&data))) {
-			return getUserAsync(dataPackage).get();
-
+		if (auto cachedUser = Users::cache.find(dataPackage.userId)) {
+			return *cachedUser;
 		} else {
-			data = Users::cache[*static_cast<UserData*>(&data)];
-			return data;
+			return getUserAsync(dataPackage).get();
 		}
 	}
 
+	std::shared_ptr<const UserData> Users::getCachedUserView(GetUserData dataPackage) {
+		return Users::cache.find(dataPackage.userId);
+	}
+
 	CoRoutine<User> Users::getUserAsync(GetUserData dataPackage) {
 		DiscordCoreInternal::HttpsWorkloadData workload{ DiscordCoreInternal::HttpsWorkloadType::Get_User };
 		co_await NewThreadAwaitable<User>();
@@ -234,8 +235,8 @@ namespace DiscordCoreAPI {
 		workload.callStack = "Users::getUserAsync()";
 		User data{};
 		data = Users::httpsClient->submitWorkloadAndGetResult<User>(workload, &data);
-		if (Users::cache.contains(data)) {
-			data = Users::cache.at(data);
+		if (auto cachedUser = Users::cache.find(data.id)) {
+			data = *cachedUser;
 		} else {
 			Users::insertUser(data);
 		}
@@ -298,16 +299,16 @@ namespace DiscordCoreAPI {
 		return Users::doWeCacheUsersBool;
 	}
 
+	ObjectCache<UserData>& Users::getCache() {
+		return Users::cache;
+	}
+
 	void Users::insertUser(UserData user) {
 		if (user.id == 0) {
 			return;
 		}
 		if (Users::doWeCacheUsers()) {
-			if (!Users::cache.contains(user)) {
-				Users::cache.emplace(std::move(user));
-			} else {
-				Users::cache[user] = std::move(user);
-			}
+			Users::cache.emplace(std::move(user));
 			if (Users::cache.size() % 10000 == 0) {
 				std::cout << "USERS COUNT: " << Users::cache.size() << std::endl;
 			}
@@ -953,6 +953,22 @@ namespace DiscordCoreAPI {
 		return this->config.cacheOptions.cacheRoles;
 	}
 
+	const HttpsTimeoutOptions ConfigManager::getHttpsTimeoutOptions() const {
+		return this->config.httpsTimeouts;
+	}
+
+	const uint32_t ConfigManager::getHttpsResponseTtlInMs() const {
+		return this->config.cacheOptions.httpsResponseTtlInMs;
+	}
+
+	const CacheOptions ConfigManager::getCacheOptions() const {
+		return this->config.cacheOptions;
+	}
+
+	const VoiceOptions ConfigManager::getVoiceOptions() const {
+		return this->config.voiceOptions;
+	}
+
 	const UpdatePresenceData ConfigManager::getPresenceData() const {
 		return this->config.presenceData;
 	}
@@ -1001,28 +1017,158 @@ namespace DiscordCoreAPI {
 		return this->config.intents;
 	}
 
+	char* StringInternEntry::data() noexcept {
+		return reinterpret_cast<char*>(this + 1);
+	}
+
+	char* StringInterner::StringInternBlock::data() noexcept {
+		return reinterpret_cast<char*>(this + 1);
+	}
+
+	void StringInterner::setEnabled(bool enabledNew) noexcept {
+		StringInterner::enabled.store(enabledNew, std::memory_order_relaxed);
+	}
+
+	bool StringInterner::isItEnabled() noexcept {
+		return StringInterner::enabled.load(std::memory_order_relaxed);
+	}
+
+	StringInternEntry* StringInterner::acquire(std::string_view string) {
+		uint64_t hash = std::hash<std::string_view>{}(string);
+		auto& shard = StringInterner::getShards()[mixCacheHash(hash) >> 60];
+		std::unique_lock lock{ shard.accessMutex };
+		if (auto iterator = shard.entries.find(string); iterator != shard.entries.end()) {
+			iterator->second->refCount.fetch_add(1, std::memory_order_relaxed);
+			return iterator->second;
+		}
+		uint64_t entrySize = StringInterner::getEntrySize(string.size());
+		StringInternBlock* block{};
+		if (entrySize > blockSize / 4) {
+			block = StringInterner::createBlock(entrySize);
+		} else {
+			if (!shard.currentBlock || shard.currentBlock->used + entrySize > shard.currentBlock->capacity) {
+				if (shard.currentBlock && shard.currentBlock->liveCount == 0) {
+					shard.byteCount -= sizeof(StringInternBlock) + shard.currentBlock->capacity;
+					::operator delete(shard.currentBlock);
+				}
+				shard.currentBlock = StringInterner::createBlock(blockSize);
+				shard.byteCount += sizeof(StringInternBlock) + blockSize;
+			}
+			block = shard.currentBlock;
+		}
+		if (block != shard.currentBlock) {
+			shard.byteCount += sizeof(StringInternBlock) + block->capacity;
+		}
+		auto entry = new (block->data() + block->used) StringInternEntry{};
+		block->used += entrySize;
+		++block->liveCount;
+		entry->length = static_cast<uint32_t>(string.size());
+		entry->refCount.store(1, std::memory_order_relaxed);
+		entry->block = block;
+		entry->hash = hash;
+		std::memcpy(entry->data(), string.data(), string.size());
+		entry->data()[string.size()] = '\0';
+		shard.entries.emplace(std::string_view{ entry->data(), string.size() }, entry);
+		return entry;
+	}
+
+	void StringInterner::release(StringInternEntry* entry) noexcept {
+		uint32_t refCount = entry->refCount.load(std::memory_order_relaxed);
+		while (refCount > 1) {
+			if (entry->refCount.compare_exchange_weak(refCount, refCount - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+				return;
+			}
+		}
+		auto& shard = StringInterner::getShards()[mixCacheHash(entry->hash) >> 60];
+		std::unique_lock lock{ shard.accessMutex };
+		if (entry->refCount.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+			return;
+		}
+		shard.entries.erase(std::string_view{ entry->data(), entry->length });
+		auto block = static_cast<StringInternBlock*>(entry->block);
+		entry->~StringInternEntry();
+		if (--block->liveCount > 0) {
+			return;
+		}
+		if (block == shard.currentBlock) {
+			block->used = 0;
+		} else {
+			shard.byteCount -= sizeof(StringInternBlock) + block->capacity;
+			::operator delete(block);
+		}
+	}
+
+	uint64_t StringInterner::getMemoryFootprint() {
+		uint64_t returnValue{};
+		auto shards = StringInterner::getShards();
+		for (uint64_t x = 0; x < shardCount; ++x) {
+			std::unique_lock lock{ shards[x].accessMutex };
+			returnValue += shards[x].byteCount;
+			returnValue += shards[x].entries.size() * (sizeof(std::pair<std::string_view, StringInternEntry*>) + 2 * sizeof(void*));
+		}
+		return returnValue;
+	}
+
+	uint64_t StringInterner::size() {
+		uint64_t returnValue{};
+		auto shards = StringInterner::getShards();
+		for (uint64_t x = 0; x < shardCount; ++x) {
+			std::unique_lock lock{ shards[x].accessMutex };
+			returnValue += shards[x].entries.size();
+		}
+		return returnValue;
+	}
+
+	StringInterner::StringInternerShard* StringInterner::getShards() {
+		/// Never destroyed, so that StringWrappers in static caches may release their strings during static destruction.
+		static StringInternerShard* shards{ new StringInternerShard[shardCount]{} };
+		return shards;
+	}
+
+	uint64_t StringInterner::getEntrySize(uint64_t length) noexcept {
+		return (sizeof(StringInternEntry) + length + 1 + alignof(StringInternEntry) - 1) & ~(alignof(StringInternEntry) - 1);
+	}
+
+	StringInterner::StringInternBlock* StringInterner::createBlock(uint64_t capacity) {
+		auto block = new (::operator new(sizeof(StringInternBlock) + capacity)) StringInternBlock{};
+		block->capacity = capacity;
+		return block;
+	}
+
+	std::atomic_bool StringInterner::enabled{};
+
 	StringWrapper& StringWrapper::operator=(StringWrapper&& other) noexcept {
 		if (this != &other) {
-			this->ptr.reset(nullptr);
-			this->ptr = std::move(other.ptr);
-			other.ptr.reset(nullptr);
-			other.ptr = nullptr;
+			this->freeStorage();
+			if (other.isItInline()) {
+				std::memcpy(this->inlineData, other.inlineData, sizeof(this->inlineData));
+			} else if (other.isItInterned()) {
+				this->internedData = other.internedData;
+			} else {
+				this->heapData = other.heapData;
+			}
+			this->capacity = other.capacity;
+			this->length = other.length;
+			other.capacity = inlineCapacity;
+			other.inlineData[0] = '\0';
+			other.length = 0;
 		}
 		return *this;
 	}
 
+	StringWrapper::StringWrapper(StringWrapper&& other) noexcept {
+		*this = std::move(other);
+	}
+
 	StringWrapper& StringWrapper::operator=(const StringWrapper& other) {
-		if (this != &other) {
-			this->ptr.reset(nullptr);
-			std::stringstream stream{};
-			if (other.ptr) {
-				stream << other.ptr;
-			}
-			auto length = stream.str().size();
-			this->ptr = std::make_unique<char[]>(length + 1);
-			for (uint64_t x = 0; x < length; ++x) {
-				this->ptr[x] = other.ptr[x];
-			}
+		if (this != &other && other.isItInterned()) {
+			other.internedData->refCount.fetch_add(1, std::memory_order_relaxed);
+			this->freeStorage();
+			this->internedData = other.internedData;
+			this->capacity = internedCapacity;
+			this->length = other.length;
+		} else if (this != &other) {
+			this->assign(other.data(), other.size());
 		}
 		return *this;
 	}
@@ -1032,12 +1178,7 @@ namespace DiscordCoreAPI {
 	}
 
 	StringWrapper& StringWrapper::operator=(const std::string& string) {
-		auto length = string.size();
-		this->ptr.reset(nullptr);
-		this->ptr = std::make_unique<char[]>(length + 1);
-		for (uint32_t x = 0; x < length; ++x) {
-			this->ptr[x] = string[x];
-		}
+		this->assign(string.data(), string.size());
 		return *this;
 	}
 
@@ -1045,16 +1186,18 @@ namespace DiscordCoreAPI {
 		*this = string;
 	}
 
+	StringWrapper& StringWrapper::operator=(std::string_view string) {
+		this->assign(string.data(), string.size());
+		return *this;
+	}
+
+	StringWrapper::StringWrapper(std::string_view string) {
+		*this = string;
+	}
+
 	StringWrapper& StringWrapper::operator=(const char* string) {
 		if (string) {
-			this->ptr.reset(nullptr);
-			std::stringstream stream{};
-			stream << string;
-			int64_t length = stream.str().size();
-			this->ptr = std::make_unique<char[]>(length + 1);
-			for (int64_t x = 0; x < length; ++x) {
-				this->ptr[x] = string[x];
-			}
+			this->assign(string, std::strlen(string));
 		}
 		return *this;
 	}
@@ -1063,43 +1206,123 @@ namespace DiscordCoreAPI {
 		*this = string;
 	}
 
-	StringWrapper::operator std::string() {
-		std::stringstream stream{};
-		if (this->ptr) {
-			stream << this->ptr;
+	StringWrapper::operator std::string() const {
+		return std::string{ this->data(), this->length };
+	}
+
+	StringWrapper::operator std::string_view() const noexcept {
+		return std::string_view{ this->data(), this->length };
+	}
+
+	void StringWrapper::emplace_back(char value) {
+		if (this->isItInterned()) {
+			this->reserve(std::max<uint64_t>(static_cast<uint64_t>(this->length) * 2, inlineCapacity + 1));
+		} else if (this->length == this->capacity) {
+			this->reserve(static_cast<uint64_t>(this->capacity) * 2);
+		}
+		char* dataNew = this->isItInline() ? this->inlineData : this->heapData;
+		dataNew[this->length] = value;
+		dataNew[++this->length] = '\0';
+	}
+
+	uint64_t StringWrapper::size() const noexcept {
+		return this->length;
+	}
+
+	bool StringWrapper::empty() const noexcept {
+		return this->length == 0;
+	}
+
+	const char* StringWrapper::data() const noexcept {
+		if (this->isItInterned()) {
+			return this->internedData->data();
 		}
-		std::string string{};
-		for (int32_t x = 0; x < stream.str().size(); ++x) {
-			string.push_back(stream.str()[x]);
+		return this->isItInline() ? this->inlineData : this->heapData;
+	}
+
+	uint64_t StringWrapper::getHeapFootprint() const noexcept {
+		if (this->isItInterned()) {
+			uint32_t refCount = std::max<uint32_t>(this->internedData->refCount.load(std::memory_order_relaxed), 1);
+			return (sizeof(StringInternEntry) + this->length + 1) / refCount;
 		}
-		return string;
+		return this->isItInline() ? 0 : static_cast<uint64_t>(this->capacity) + 1;
 	}
 
-	void StringWrapper::emplace_back(char value) {
-		std::stringstream stream{};
-		if (this->ptr) {
-			stream << this->ptr;
+	StringWrapper StringWrapper::intern(std::string_view string) {
+		StringWrapper returnValue{};
+		if (!StringInterner::isItEnabled() || string.size() <= inlineCapacity) {
+			returnValue = string;
+			return returnValue;
 		}
-		auto length = stream.str().size();
-		this->ptr = std::make_unique<char[]>(length + 2);
+		returnValue.internedData = StringInterner::acquire(string);
+		returnValue.capacity = internedCapacity;
+		returnValue.length = static_cast<uint32_t>(string.size());
+		return returnValue;
+	}
 
-		for (uint64_t x = 0; x < length; ++x) {
-			this->ptr[x] = stream.str()[x];
+	StringWrapper::~StringWrapper() noexcept {
+		this->freeStorage();
+	}
+
+	bool StringWrapper::isItInterned() const noexcept {
+		return this->capacity == internedCapacity;
+	}
+
+	bool StringWrapper::isItInline() const noexcept {
+		return this->capacity == inlineCapacity;
+	}
+
+	void StringWrapper::freeStorage() noexcept {
+		if (this->isItInterned()) {
+			StringInterner::release(this->internedData);
+		} else if (!this->isItInline()) {
+			delete[] this->heapData;
 		}
-		this->ptr[length] = value;
 	}
 
-	uint64_t StringWrapper::size() {
-		std::stringstream stream{};
-		if (this->ptr) {
-			stream << this->ptr;
+	void StringWrapper::assign(const char* string, uint64_t lengthNew) {
+		if (lengthNew > std::numeric_limits<uint32_t>::max() - 1) {
+			throw DCAException{ "StringWrapper::assign() Error: String too long." };
 		}
-		auto length = stream.str().size();
-		return length;
+		if (this->isItInterned()) {
+			if (lengthNew > inlineCapacity) {
+				char* heapDataNew = new char[lengthNew + 1];
+				std::memcpy(heapDataNew, string, lengthNew);
+				this->freeStorage();
+				this->heapData = heapDataNew;
+				this->capacity = static_cast<uint32_t>(lengthNew);
+			} else {
+				char inlineDataNew[inlineCapacity + 1]{};
+				std::memcpy(inlineDataNew, string, lengthNew);
+				this->freeStorage();
+				std::memcpy(this->inlineData, inlineDataNew, sizeof(this->inlineData));
+				this->capacity = inlineCapacity;
+			}
+		} else if (lengthNew > this->capacity) {
+			char* heapDataNew = new char[lengthNew + 1];
+			std::memcpy(heapDataNew, string, lengthNew);
+			this->freeStorage();
+			this->heapData = heapDataNew;
+			this->capacity = static_cast<uint32_t>(lengthNew);
+		} else {
+			std::memmove(this->isItInline() ? this->inlineData : this->heapData, string, lengthNew);
+		}
+		this->length = static_cast<uint32_t>(lengthNew);
+		(this->isItInline() ? this->inlineData : this->heapData)[lengthNew] = '\0';
 	}
 
-	const char* StringWrapper::data() {
-		return this->ptr.get();
+	void StringWrapper::reserve(uint64_t capacityNew) {
+		if (!this->isItInterned() && capacityNew <= this->capacity) {
+			return;
+		}
+		if (capacityNew > std::numeric_limits<uint32_t>::max() - 1) {
+			throw DCAException{ "StringWrapper::reserve() Error: String too long." };
+		}
+		char* heapDataNew = new char[capacityNew + 1];
+		std::memcpy(heapDataNew, this->data(), static_cast<uint64_t>(this->length) + 1);
+		this->freeStorage();
+		this->heapData = heapDataNew;
+		this->capacity = static_cast<uint32_t>(capacityNew);
 	}
 
 	ColorValue::ColorValue(uint32_t colorValue) {
@@ -1235,7 +1458,7 @@ namespace DiscordCoreAPI {
 		*this = permsNew;
 	}
 
-	Permissions::operator uint64_t() {
+	Permissions::operator uint64_t() const {
 		return this->permissions;
 	}
 
@@ -1249,12 +1472,11 @@ namespace DiscordCoreAPI {
 	}
 
 	bool Permissions::checkForPermission(const GuildMember& guildMember, const ChannelData& channel, Permission permission) {
-		std::string permissionsString = Permissions::computePermissions(guildMember, channel);
-		if ((stoull(permissionsString) & static_cast<uint64_t>(permission)) == static_cast<uint64_t>(permission)) {
-			return true;
-		} else {
-			return false;
+		uint64_t permissions{};
+		if (!PermissionEngine::computeChannelPermissions(guildMember, channel.id, permissions)) {
+			permissions = stoull(Permissions::computePermissions(guildMember, channel));
 		}
+		return (permissions & static_cast<uint64_t>(permission)) == static_cast<uint64_t>(permission);
 	}
 
 	std::string Permissions::getCurrentGuildPermissions(const GuildMember& guildMember) {
@@ -1446,15 +1668,11 @@ namespace DiscordCoreAPI {
 				break;
 			}
 		}
-		std::vector<RoleData> guildMemberRoles{};
-		for (auto& value: guildMember.roles) {
-			guildMemberRoles.emplace_back(Roles::getCachedRole({ .guildId = guildMember.guildId, .roleId = value }));
-		}
 		uint64_t allow{};
 		uint64_t deny{};
-		for (auto& value: guildMemberRoles) {
+		for (auto& value: guildMember.roles) {
 			for (int32_t x = 0; x < channel.permissionOverwrites.size(); ++x) {
-				if (value.id == channel.permissionOverwrites[x].id) {
+				if (value == channel.permissionOverwrites[x].id) {
 					allow |= channel.permissionOverwrites[x].allow;
 					deny |= channel.permissionOverwrites[x].deny;
 				}
@@ -1473,39 +1691,41 @@ namespace DiscordCoreAPI {
 	}
 
 	std::string Permissions::computePermissions(const GuildMember& guildMember, const ChannelData& channel) {
+		uint64_t permissionsInteger{};
+		if (PermissionEngine::computeChannelPermissions(guildMember, channel.id, permissionsInteger)) {
+			return std::to_string(permissionsInteger);
+		}
 		std::string permissions = Permissions::computeBasePermissions(guildMember);
 		permissions = Permissions::computeOverwrites(permissions, guildMember, channel);
 		return permissions;
 	}
 
 	std::string Permissions::computeBasePermissions(const GuildMember& guildMember) {
-		const GuildData guild = Guilds::getCachedGuild({ .guildId = guildMember.guildId });
-		if (guild.ownerId == guildMember.id) {
-			return Permissions::getAllPermissions();
+		uint64_t permissionsInteger{};
+		if (PermissionEngine::computeBasePermissions(guildMember, permissionsInteger)) {
+			return std::to_string(permissionsInteger);
 		}
-		std::vector<RoleData> guildRoles{};
-		for (auto& value: guild.roles) {
-			guildRoles.emplace_back(Roles::getCachedRole({ .guildId = guild.id, .roleId = value }));
+		auto guild = Guilds::getCachedGuildView({ .guildId = guildMember.guildId });
+		if (!guild) {
+			guild = std::make_shared<const GuildData>(Guilds::getCachedGuild({ .guildId = guildMember.guildId }));
 		}
-		RoleData roleEveryone{};
-		for (auto& value: guildRoles) {
-			if (value.id == guild.id) {
-				roleEveryone = value;
-			}
+		if (guild->ownerId == guildMember.id) {
+			return Permissions::getAllPermissions();
 		}
+		auto getRolePermissions = [&](const Snowflake roleId) -> uint64_t {
+			if (auto role = Roles::getCachedRoleView({ .guildId = guild->id, .roleId = roleId })) {
+				return role->permissions;
+			}
+			return Roles::getCachedRole({ .guildId = guild->id, .roleId = roleId }).permissions;
+		};
 		uint64_t permissions{};
-		if (roleEveryone.permissions != 0) {
-			permissions = roleEveryone.permissions;
+		for (auto& value: guild->roles) {
+			if (value == guild->id) {
+				permissions = getRolePermissions(value);
+			}
 		}
-		GetGuildMemberRolesData getRolesData{};
-		getRolesData.guildMember = guildMember;
-		getRolesData.guildId = guildMember.guildId;
-		std::vector<RoleData> guildMemberRoles{};
 		for (auto& value: guildMember.roles) {
-			guildMemberRoles.emplace_back(Roles::getCachedRole({ .guildId = guild.id, .roleId = value }));
-		}
-		for (auto& value: guildMemberRoles) {
-			permissions |= value.permissions;
+			permissions |= getRolePermissions(value);
 		}
 
 		if ((permissions & static_cast<uint64_t>(Permission::Administrator)) == static_cast<uint64_t>(Permission::Administrator)) {
@@ -1515,6 +1735,157 @@ namespace DiscordCoreAPI {
 		return std::to_string(permissions);
 	}
 
+	const uint64_t allPermissionBits{ (1ull << 41) - 1 };
+
+	uint64_t getCacheFootprint(const GuildPermissionTable& object) noexcept {
+		uint64_t returnValue{ sizeof(GuildPermissionTable) };
+		returnValue += object.rolePermissions.size() * (sizeof(uint64_t) * 2 + sizeof(void*));
+		for (auto& [key, value]: object.channels) {
+			returnValue += sizeof(uint64_t) + sizeof(ChannelPermissionTable) + sizeof(void*);
+			returnValue += (value.memberOverwrites.capacity() + value.roleOverwrites.capacity()) * sizeof(PermissionOverwriteEntry);
+		}
+		return returnValue;
+	}
+
+	void PermissionEngine::updateRole(const Snowflake guildId, const Snowflake roleId, uint64_t permissions) {
+		GuildPermissionTable table{};
+		table.guildId = guildId;
+		PermissionEngine::cache.emplaceOrModify(std::move(table), [&](GuildPermissionTable& value) {
+			value.rolePermissions.insert_or_assign(static_cast<uint64_t>(roleId), permissions);
+		});
+	}
+
+	void PermissionEngine::removeRole(const Snowflake guildId, const Snowflake roleId) {
+		PermissionEngine::cache.modify(guildId, [&](GuildPermissionTable& value) {
+			value.rolePermissions.erase(static_cast<uint64_t>(roleId));
+			for (auto& [key, channel]: value.channels) {
+				std::erase_if(channel.roleOverwrites, [&](const PermissionOverwriteEntry& entry) {
+					return entry.id == static_cast<uint64_t>(roleId);
+				});
+			}
+		});
+	}
+
+	void PermissionEngine::updateChannel(const ChannelData& channel) {
+		if (channel.guildId == 0) {
+			return;
+		}
+		ChannelPermissionTable channelTable{};
+		for (auto& value: channel.permissionOverwrites) {
+			PermissionOverwriteEntry entry{ .allow = value.allow, .deny = value.deny, .id = static_cast<uint64_t>(value.id) };
+			if (value.id == channel.guildId) {
+				channelTable.everyoneOverwrite = entry;
+			} else if (value.type == PermissionOverwritesType::Role) {
+				channelTable.roleOverwrites.emplace_back(entry);
+			} else {
+				channelTable.memberOverwrites.emplace_back(entry);
+			}
+		}
+		auto compareIds = [](const PermissionOverwriteEntry& lhs, const PermissionOverwriteEntry& rhs) {
+			return lhs.id < rhs.id;
+		};
+		std::sort(channelTable.roleOverwrites.begin(), channelTable.roleOverwrites.end(), compareIds);
+		std::sort(channelTable.memberOverwrites.begin(), channelTable.memberOverwrites.end(), compareIds);
+		GuildPermissionTable table{};
+		table.guildId = channel.guildId;
+		PermissionEngine::cache.emplaceOrModify(std::move(table), [&](GuildPermissionTable& value) {
+			value.channels.insert_or_assign(static_cast<uint64_t>(channel.id), std::move(channelTable));
+		});
+	}
+
+	void PermissionEngine::removeChannel(const Snowflake guildId, const Snowflake channelId) {
+		PermissionEngine::cache.modify(guildId, [&](GuildPermissionTable& value) {
+			value.channels.erase(static_cast<uint64_t>(channelId));
+		});
+	}
+
+	void PermissionEngine::updateOwner(const Snowflake guildId, const Snowflake ownerId) {
+		GuildPermissionTable table{};
+		table.guildId = guildId;
+		PermissionEngine::cache.emplaceOrModify(std::move(table), [&](GuildPermissionTable& value) {
+			value.ownerId = ownerId;
+		});
+	}
+
+	void PermissionEngine::removeGuild(const Snowflake guildId) {
+		PermissionEngine::cache.erase(guildId);
+	}
+
+	bool PermissionEngine::computeBasePermissions(const GuildMemberData& guildMember, uint64_t& permissions) {
+		bool returnValue{};
+		PermissionEngine::cache.visit(guildMember.guildId, [&](const GuildPermissionTable& table) {
+			returnValue = PermissionEngine::computeBasePermissions(table, guildMember, permissions);
+		});
+		return returnValue;
+	}
+
+	bool PermissionEngine::computeChannelPermissions(const GuildMemberData& guildMember, const Snowflake channelId, uint64_t& permissions) {
+		bool returnValue{};
+		PermissionEngine::cache.visit(guildMember.guildId, [&](const GuildPermissionTable& table) {
+			auto channel = table.channels.find(static_cast<uint64_t>(channelId));
+			if (channel == table.channels.end() || !PermissionEngine::computeBasePermissions(table, guildMember, permissions)) {
+				return;
+			}
+			returnValue = true;
+			if ((permissions & static_cast<uint64_t>(Permission::Administrator)) == static_cast<uint64_t>(Permission::Administrator)) {
+				return;
+			}
+			auto findOverwrite = [](const std::vector<PermissionOverwriteEntry>& overwrites, uint64_t id) {
+				auto entry = std::lower_bound(overwrites.begin(), overwrites.end(), id,
+					[](const PermissionOverwriteEntry& lhs, uint64_t rhs) {
+						return lhs.id < rhs;
+					});
+				return entry != overwrites.end() && entry->id == id ? &*entry : nullptr;
+			};
+			auto& overwrites = channel->second;
+			permissions &= ~overwrites.everyoneOverwrite.deny;
+			permissions |= overwrites.everyoneOverwrite.allow;
+			uint64_t allow{};
+			uint64_t deny{};
+			for (auto& value: guildMember.roles) {
+				if (auto entry = findOverwrite(overwrites.roleOverwrites, static_cast<uint64_t>(value))) {
+					allow |= entry->allow;
+					deny |= entry->deny;
+				}
+			}
+			permissions &= ~deny;
+			permissions |= allow;
+			if (auto entry = findOverwrite(overwrites.memberOverwrites, static_cast<uint64_t>(guildMember.id))) {
+				permissions &= ~entry->deny;
+				permissions |= entry->allow;
+			}
+		});
+		return returnValue;
+	}
+
+	ObjectCache<GuildPermissionTable>& PermissionEngine::getCache() {
+		return PermissionEngine::cache;
+	}
+
+	bool PermissionEngine::computeBasePermissions(const GuildPermissionTable& table, const GuildMemberData& guildMember,
+		uint64_t& permissions) {
+		if (table.ownerId == guildMember.id) {
+			permissions = allPermissionBits;
+			return true;
+		}
+		auto everyone = table.rolePermissions.find(static_cast<uint64_t>(guildMember.guildId));
+		if (everyone == table.rolePermissions.end()) {
+			return false;
+		}
+		permissions = everyone->second;
+		for (auto& value: guildMember.roles) {
+			if (auto role = table.rolePermissions.find(static_cast<uint64_t>(value)); role != table.rolePermissions.end()) {
+				permissions |= role->second;
+			}
+		}
+		if ((permissions & static_cast<uint64_t>(Permission::Administrator)) == static_cast<uint64_t>(Permission::Administrator)) {
+			permissions = allPermissionBits;
+		}
+		return true;
+	}
+
+	ObjectCache<GuildPermissionTable> PermissionEngine::cache{};
+
 	void reportException(const std::string& currentFunctionName, std::source_location location) {
 		try {
 			auto currentException = std::current_exception();
@@ -1554,29 +1925,6 @@ namespace DiscordCoreAPI {
 		}
 	}
 
-	std::string constructMultiPartData(const std::string& data, const std::vector<File>& files) {
-		const std::string boundary("boundary25");
-		const std::string partStart("--" + boundary + "\r\nContent-Type: application/octet-stream\r\nContent-Disposition: form-data; ");
-
-		std::string content("--" + boundary);
-
-		content += "\r\nContent-Type: application/json\r\nContent-Disposition: form-data; "
-				   "name=\"payload_json\"\r\n\r\n";
-		content += data + "\r\n";
-		if (files.size() == 1) {
-			content += partStart + "name=\"file\"; filename=\"" + files[0].fileName + "\"" + "\r\n\r\n";
-			content += files[0].data;
-		} else {
-			for (int8_t x = 0; x < files.size(); ++x) {
-				content += partStart + "name=\"files[" + std::to_string(x) + "]\"; filename=\"" + files[x].fileName + "\"\r\n\r\n";
-				content += files[x].data;
-				content += "\r\n";
-			}
-		}
-		content += "\r\n--" + boundary + "--";
-		return content;
-	}
-
 	std::string convertToLowerCase(const std::string& stringToConvert) {
 		std::string newString;
 		for (auto& value: stringToConvert) {
@@ -1861,6 +2209,10 @@ namespace DiscordCoreAPI {
 		return this->timeStampInTimeUnits;
 	}
 
+	uint64_t TimeStamp::getTimeStampInTimeUnits() const noexcept {
+		return this->timeStampInTimeUnits;
+	}
+
 	TimeStamp& TimeStamp::operator=(std::string&& originalTimeStampNew) {
 		this->convertTimeStampToTimeUnits(TimeFormat::LongDateTime, originalTimeStampNew);
 		return *this;
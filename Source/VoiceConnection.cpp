@@ -26,6 +26,11 @@
 #include <discordcoreapi/VoiceConnection.hpp>
 #include <discordcoreapi/DiscordCoreClient.hpp>
 
+#ifdef __linux__
+	#include <sys/epoll.h>
+	#include <sys/prctl.h>
+#endif
+
 namespace DiscordCoreAPI {
 
 	VoiceSocketReadyData::VoiceSocketReadyData(simdjson::ondemand::value jsonObjectData) {
@@ -35,44 +40,255 @@ namespace DiscordCoreAPI {
 		if (jsonObjectData["modes"].get(arrayValue) == simdjson::error_code::SUCCESS) {
 			this->mode.clear();
 			for (simdjson::simdjson_result<simdjson::ondemand::value> value: arrayValue) {
-				if (std::string{ value.get_string().take_value() } == "xsalsa20_poly1305") {
-					this->mode = std::string{ value.get_string().take_value() };
+				std::string_view modeName{};
+				if (value.get_string().get(modeName) != simdjson::error_code::SUCCESS) {
+					continue;
+				}
+				VoiceEncryptionMode newMode{ RTPPacketEncrypter::getEncryptionMode(modeName) };
+				if (newMode == VoiceEncryptionMode::Aead_Aes256_Gcm_RtpSize && crypto_aead_aes256gcm_is_available() == 0) {
+					continue;
+				}
+				if (newMode != VoiceEncryptionMode::Unset &&
+					(this->encryptionMode == VoiceEncryptionMode::Unset || newMode < this->encryptionMode)) {
+					this->encryptionMode = newMode;
+					this->mode = std::string{ modeName };
 				}
 			}
 		}
 		this->port = getUint64(jsonObjectData, "port");
 	}
 
-	VoiceUser::VoiceUser(Snowflake userIdNew) noexcept {
+	void VoiceJitterBuffer::insertPacket(std::basic_string_view<std::byte> packet) noexcept {
+		if (packet.size() < 12) {
+			return;
+		}
+		const uint16_t sequence{ ntohs(*reinterpret_cast<const uint16_t*>(packet.data() + 2)) };
+		const uint32_t timeStamp{ ntohl(*reinterpret_cast<const uint32_t*>(packet.data() + 4)) };
+		const int64_t arrival{ std::chrono::duration_cast<Microseconds>(SteadyClock::now().time_since_epoch()).count() * 48 / 1000 };
+		if (!this->areWeInitialized) {
+			this->areWeInitialized = true;
+			this->nextSequence = sequence;
+		} else {
+			const int64_t difference{ (arrival - this->lastArrival) - static_cast<int32_t>(timeStamp - this->lastTimeStamp) };
+			this->jitter += (static_cast<double>(std::abs(difference)) - this->jitter) / 16.0;
+			this->stats.jitterMs = static_cast<float>(this->jitter / 48.0);
+			this->updateTargetDepth();
+		}
+		this->lastTimeStamp = timeStamp;
+		this->lastArrival = arrival;
+		const int16_t offset{ static_cast<int16_t>(sequence - this->nextSequence) };
+		if (offset < 0) {
+			if (-offset >= static_cast<int16_t>(slotCount)) {
+				this->reset();
+				this->nextSequence = sequence;
+			} else {
+				++this->stats.packetsLate;
+				return;
+			}
+		} else if (offset >= static_cast<int16_t>(slotCount)) {
+			this->reset();
+			this->nextSequence = sequence;
+		}
+		JitterBufferSlot& slot{ this->slots[sequence % slotCount] };
+		if (slot.occupied) {
+			return;
+		}
+		slot.data.assign(packet.data(), packet.size());
+		slot.timeStamp = timeStamp;
+		slot.sequence = sequence;
+		slot.occupied = true;
+		++this->stats.packetsReceived;
+		++this->bufferedCount;
+	}
+
+	JitterBufferFrame VoiceJitterBuffer::popFrame() noexcept {
+		if (!this->areWePlaying) {
+			if (this->bufferedCount < this->stats.targetDepth || this->bufferedCount == 0) {
+				return {};
+			}
+			this->areWePlaying = true;
+		}
+		if (this->bufferedCount == 0) {
+			this->areWePlaying = false;
+			return {};
+		}
+		while (this->bufferedCount > this->stats.targetDepth + 2) {
+			JitterBufferSlot& slot{ this->slots[this->nextSequence % slotCount] };
+			if (slot.occupied && slot.sequence == this->nextSequence) {
+				slot.occupied = false;
+				--this->bufferedCount;
+				++this->stats.packetsDiscarded;
+			} else {
+				++this->stats.packetsLost;
+			}
+			++this->nextSequence;
+		}
+		JitterBufferSlot& slot{ this->slots[this->nextSequence % slotCount] };
+		if (slot.occupied && slot.sequence == this->nextSequence) {
+			slot.occupied = false;
+			--this->bufferedCount;
+			++this->nextSequence;
+			this->consecutiveLost = 0;
+			return { slot.data, JitterBufferFrameType::Packet };
+		}
+		++this->stats.packetsLost;
+		++this->nextSequence;
+		if (++this->consecutiveLost > maxConcealedFrames) {
+			this->skipToEarliest();
+			return {};
+		}
+		JitterBufferSlot& nextSlot{ this->slots[this->nextSequence % slotCount] };
+		if (nextSlot.occupied && nextSlot.sequence == this->nextSequence) {
+			return { nextSlot.data, JitterBufferFrameType::Lost };
+		}
+		return { {}, JitterBufferFrameType::Lost };
+	}
+
+	VoiceUserStats& VoiceJitterBuffer::getStats() noexcept {
+		return this->stats;
+	}
+
+	void VoiceJitterBuffer::updateTargetDepth() noexcept {
+		const uint64_t depth{ static_cast<uint64_t>(std::ceil(2.0 * this->jitter / frameSampleCount)) + 1 };
+		this->stats.targetDepth = std::min(depth, maxDepth);
+	}
+
+	void VoiceJitterBuffer::skipToEarliest() noexcept {
+		for (uint64_t x = 0; x < slotCount; ++x) {
+			const uint16_t sequence{ static_cast<uint16_t>(this->nextSequence + x) };
+			if (this->slots[sequence % slotCount].occupied && this->slots[sequence % slotCount].sequence == sequence) {
+				this->stats.packetsLost += x;
+				this->nextSequence = sequence;
+				break;
+			}
+		}
+		this->consecutiveLost = 0;
+	}
+
+	void VoiceJitterBuffer::reset() noexcept {
+		for (auto& value: this->slots) {
+			value.occupied = false;
+		}
+		this->consecutiveLost = 0;
+		this->bufferedCount = 0;
+		this->areWePlaying = false;
+	}
+
+	VoiceUser::VoiceUser(Snowflake userIdNew, DiscordCoreInternal::OpusDecoderPool* decoderPoolNew) noexcept {
+		this->jitterBuffer.getStats().userId = userIdNew;
+		this->jitterBuffer.getStats().targetDepth = 1;
+		this->decoderPool = decoderPoolNew;
 		this->userId = userIdNew;
 	}
 
 	VoiceUser& VoiceUser::operator=(VoiceUser&& data) noexcept {
-		this->payloads = std::move(data.payloads);
+		this->releaseDecoder();
+		this->jitterBuffer = std::move(data.jitterBuffer);
+		this->decoderPool = data.decoderPool;
 		this->decoder = std::move(data.decoder);
+		this->idleTicks = data.idleTicks;
 		this->userId = data.userId;
+		this->gain = data.gain;
 		return *this;
 	}
 
-	DiscordCoreInternal::OpusDecoderWrapper& VoiceUser::getDecoder() noexcept {
-		return this->decoder;
+	std::basic_string_view<opus_int16> VoiceUser::decodeNextFrame(RTPPacketDecrypter& decrypter) {
+		JitterBufferFrame frame{ this->jitterBuffer.popFrame() };
+		if (frame.type == JitterBufferFrameType::None) {
+			if (this->decoder && ++this->idleTicks >= maxIdleTicks) {
+				this->releaseDecoder();
+			}
+			return {};
+		}
+		std::basic_string_view<std::byte> payload{};
+		if (frame.packet.size() > 0) {
+			payload = decrypter.decryptPacket(frame.packet);
+		}
+		if (frame.type == JitterBufferFrameType::Packet) {
+			if (payload.size() == 0) {
+				if (!this->decoder) {
+					return {};
+				}
+				return this->decoder->concealLoss(VoiceJitterBuffer::frameSampleCount);
+			} else if (VoiceUser::isItSilence(payload)) {
+				++this->idleTicks;
+				return {};
+			}
+			this->idleTicks = 0;
+			return this->getDecoder().decodeData(payload);
+		}
+		if (!this->decoder) {
+			return {};
+		} else if (payload.size() > 0) {
+			if (VoiceUser::isItSilence(payload)) {
+				return {};
+			}
+			++this->jitterBuffer.getStats().packetsRecovered;
+			return this->decoder->decodeData(payload, true);
+		}
+		++this->jitterBuffer.getStats().packetsConcealed;
+		return this->decoder->concealLoss(VoiceJitterBuffer::frameSampleCount);
 	}
 
 	void VoiceUser::insertPayload(std::basic_string_view<std::byte> data) noexcept {
-		this->payloads.writeData(data);
+		this->jitterBuffer.insertPacket(data);
 	}
 
-	std::basic_string_view<std::byte> VoiceUser::extractPayload() noexcept {
-		return this->payloads.readData();
+	VoiceUserStats VoiceUser::getStats() noexcept {
+		return this->jitterBuffer.getStats();
+	}
+
+	void VoiceUser::setGain(float gainNew) noexcept {
+		this->gain = gainNew;
 	}
 
 	Snowflake VoiceUser::getUserId() noexcept {
 		return this->userId;
 	}
 
-	RTPPacketEncrypter::RTPPacketEncrypter(uint32_t ssrcNew, const std::basic_string<std::byte>& keysNew) noexcept {
+	float VoiceUser::getGain() noexcept {
+		return this->gain;
+	}
+
+	VoiceUser::~VoiceUser() noexcept {
+		this->releaseDecoder();
+	}
+
+	bool VoiceUser::isItSilence(std::basic_string_view<std::byte> payload) noexcept {
+		if (payload.size() <= 2) {
+			return true;
+		}
+		return payload.size() == 3 && payload[0] == std::byte{ 0xf8 } && payload[1] == std::byte{ 0xff } && payload[2] == std::byte{ 0xfe };
+	}
+
+	DiscordCoreInternal::OpusDecoderWrapper& VoiceUser::getDecoder() {
+		if (!this->decoder) {
+			if (this->decoderPool) {
+				this->decoder = this->decoderPool->acquireDecoder();
+			} else {
+				this->decoder = std::make_unique<DiscordCoreInternal::OpusDecoderWrapper>();
+			}
+		}
+		return *this->decoder;
+	}
+
+	void VoiceUser::releaseDecoder() noexcept {
+		if (this->decoder && this->decoderPool) {
+			this->decoderPool->releaseDecoder(std::move(this->decoder));
+		}
+		this->decoder.reset();
+		this->idleTicks = 0;
+	}
+
+	RTPPacketEncrypter::RTPPacketEncrypter(uint32_t ssrcNew, const std::basic_string<std::byte>& keysNew,
+		VoiceEncryptionMode modeNew) noexcept {
+		this->data.resize(12 + 1276 + crypto_secretbox_MACBYTES + sizeof(uint32_t));
 		this->keys = keysNew;
 		this->ssrc = ssrcNew;
+		this->mode = modeNew;
+		if (this->mode == VoiceEncryptionMode::Aead_Aes256_Gcm_RtpSize && this->keys.size() == crypto_aead_aes256gcm_KEYBYTES) {
+			crypto_aead_aes256gcm_beforenm(&this->aesState, reinterpret_cast<const uint8_t*>(this->keys.data()));
+		}
 	}
 
 	std::basic_string_view<std::byte> RTPPacketEncrypter::encryptPacket(DiscordCoreInternal::EncoderReturnData& audioData) noexcept {
@@ -80,26 +296,47 @@ namespace DiscordCoreAPI {
 			++this->sequence;
 			this->timeStamp += static_cast<uint32_t>(audioData.sampleCount);
 			const uint8_t headerSize{ 12 };
-			char header[headerSize]{};
+			const bool isItAead{ this->mode == VoiceEncryptionMode::Aead_Aes256_Gcm_RtpSize ||
+				this->mode == VoiceEncryptionMode::Aead_XChaCha20_Poly1305_RtpSize };
+			const uint64_t numOfBytes{ headerSize + audioData.data.size() + crypto_secretbox_MACBYTES + (isItAead ? sizeof(uint32_t) : 0) };
+			if (this->data.size() < numOfBytes) {
+				this->data.resize(numOfBytes);
+			}
+			char* header{ reinterpret_cast<char*>(this->data.data()) };
 			storeBits(header, this->version);
 			storeBits(header + 1, this->flags);
 			storeBits(header + 2, this->sequence);
 			storeBits(header + 4, this->timeStamp);
 			storeBits(header + 8, this->ssrc);
-			uint8_t nonceForLibSodium[crypto_secretbox_NONCEBYTES]{};
-			for (int8_t x = 0; x < headerSize; ++x) {
-				nonceForLibSodium[x] = header[x];
+			uint8_t* packet{ reinterpret_cast<uint8_t*>(this->data.data()) };
+			std::memcpy(packet + headerSize, audioData.data.data(), audioData.data.size());
+			unsigned long long encryptedSize{};
+			int32_t result{ -1 };
+			if (isItAead) {
+				++this->nonceCount;
+				storeBits(reinterpret_cast<char*>(this->nonce), this->nonceCount);
+				std::memcpy(packet + numOfBytes - sizeof(uint32_t), this->nonce, sizeof(uint32_t));
 			}
-			const uint64_t numOfBytes{ headerSize + audioData.data.size() + crypto_secretbox_MACBYTES };
-			if (this->data.size() < numOfBytes) {
-				this->data.resize(numOfBytes);
-			}
-			for (int8_t x = 0; x < headerSize; ++x) {
-				this->data[x] = static_cast<std::byte>(header[x]);
+			switch (this->mode) {
+				case VoiceEncryptionMode::Aead_Aes256_Gcm_RtpSize: {
+					result = crypto_aead_aes256gcm_encrypt_afternm(packet + headerSize, &encryptedSize, packet + headerSize,
+						audioData.data.size(), packet, headerSize, nullptr, this->nonce, &this->aesState);
+					break;
+				}
+				case VoiceEncryptionMode::Aead_XChaCha20_Poly1305_RtpSize: {
+					result = crypto_aead_xchacha20poly1305_ietf_encrypt(packet + headerSize, &encryptedSize, packet + headerSize,
+						audioData.data.size(), packet, headerSize, nullptr, this->nonce,
+						reinterpret_cast<const uint8_t*>(this->keys.data()));
+					break;
+				}
+				default: {
+					std::memcpy(this->nonce, packet, headerSize);
+					result = crypto_secretbox_easy(packet + headerSize, packet + headerSize, audioData.data.size(), this->nonce,
+						reinterpret_cast<const uint8_t*>(this->keys.data()));
+					break;
+				}
 			}
-			if (crypto_secretbox_easy(reinterpret_cast<uint8_t*>(this->data.data()) + headerSize,
-					reinterpret_cast<const uint8_t*>(audioData.data.data()), audioData.data.size(), nonceForLibSodium,
-					reinterpret_cast<uint8_t*>(this->keys.data())) != 0) {
+			if (result != 0) {
 				return {};
 			}
 			return std::basic_string_view<std::byte>{ this->data.data(), numOfBytes };
@@ -107,6 +344,88 @@ namespace DiscordCoreAPI {
 		return {};
 	}
 
+	VoiceEncryptionMode RTPPacketEncrypter::getEncryptionMode(std::string_view modeName) noexcept {
+		if (modeName == "aead_aes256_gcm_rtpsize") {
+			return VoiceEncryptionMode::Aead_Aes256_Gcm_RtpSize;
+		} else if (modeName == "aead_xchacha20_poly1305_rtpsize") {
+			return VoiceEncryptionMode::Aead_XChaCha20_Poly1305_RtpSize;
+		} else if (modeName == "xsalsa20_poly1305") {
+			return VoiceEncryptionMode::XSalsa20_Poly1305;
+		}
+		return VoiceEncryptionMode::Unset;
+	}
+
+	void RTPPacketEncrypter::skipFrame(size_t sampleCount) noexcept {
+		this->timeStamp += static_cast<uint32_t>(sampleCount);
+	}
+
+	RTPPacketDecrypter::RTPPacketDecrypter(const std::basic_string<std::byte>& keysNew, VoiceEncryptionMode modeNew) noexcept {
+		this->keys = keysNew;
+		this->mode = modeNew;
+		if (this->mode == VoiceEncryptionMode::Aead_Aes256_Gcm_RtpSize && this->keys.size() == crypto_aead_aes256gcm_KEYBYTES) {
+			crypto_aead_aes256gcm_beforenm(&this->aesState, reinterpret_cast<const uint8_t*>(this->keys.data()));
+		}
+	}
+
+	std::basic_string_view<std::byte> RTPPacketDecrypter::decryptPacket(std::basic_string_view<std::byte> packet) noexcept {
+		const uint64_t headerSize{ 12 };
+		if (this->keys.size() == 0 || packet.size() <= headerSize) {
+			return {};
+		}
+		const uint64_t csrcCount{ static_cast<uint64_t>(packet[0]) & 0b0000'1111 };
+		const bool hasExtension{ (static_cast<uint8_t>(packet[0]) & 0b0001'0000) != 0 };
+		const uint8_t* packetData{ reinterpret_cast<const uint8_t*>(packet.data()) };
+		uint64_t offsetToData{ headerSize + sizeof(uint32_t) * csrcCount };
+		unsigned long long decryptedSize{};
+		uint64_t extensionLength{};
+		int32_t result{ -1 };
+		if (this->mode == VoiceEncryptionMode::Aead_Aes256_Gcm_RtpSize ||
+			this->mode == VoiceEncryptionMode::Aead_XChaCha20_Poly1305_RtpSize) {
+			if (hasExtension) {
+				if (packet.size() < offsetToData + sizeof(uint32_t)) {
+					return {};
+				}
+				extensionLength = sizeof(uint32_t) * ntohs(*reinterpret_cast<const uint16_t*>(packetData + offsetToData + 2));
+				offsetToData += sizeof(uint32_t);
+			}
+			if (packet.size() < offsetToData + crypto_aead_aes256gcm_ABYTES + sizeof(uint32_t)) {
+				return {};
+			}
+			const uint64_t encryptedLength{ packet.size() - offsetToData - sizeof(uint32_t) };
+			if (this->data.size() < encryptedLength) {
+				this->data.resize(encryptedLength);
+			}
+			std::memcpy(this->nonce, packetData + packet.size() - sizeof(uint32_t), sizeof(uint32_t));
+			if (this->mode == VoiceEncryptionMode::Aead_Aes256_Gcm_RtpSize) {
+				result = crypto_aead_aes256gcm_decrypt_afternm(reinterpret_cast<uint8_t*>(this->data.data()), &decryptedSize, nullptr,
+					packetData + offsetToData, encryptedLength, packetData, offsetToData, this->nonce, &this->aesState);
+			} else {
+				result = crypto_aead_xchacha20poly1305_ietf_decrypt(reinterpret_cast<uint8_t*>(this->data.data()), &decryptedSize, nullptr,
+					packetData + offsetToData, encryptedLength, packetData, offsetToData, this->nonce,
+					reinterpret_cast<const uint8_t*>(this->keys.data()));
+			}
+		} else {
+			if (packet.size() < offsetToData + crypto_secretbox_MACBYTES) {
+				return {};
+			}
+			const uint64_t encryptedLength{ packet.size() - offsetToData };
+			if (this->data.size() < encryptedLength) {
+				this->data.resize(encryptedLength);
+			}
+			std::memcpy(this->nonce, packetData, headerSize);
+			result = crypto_secretbox_open_easy(reinterpret_cast<uint8_t*>(this->data.data()), packetData + offsetToData, encryptedLength,
+				this->nonce, reinterpret_cast<const uint8_t*>(this->keys.data()));
+			decryptedSize = encryptedLength - crypto_secretbox_MACBYTES;
+			if (result == 0 && hasExtension && decryptedSize >= sizeof(uint32_t)) {
+				extensionLength = sizeof(uint32_t) * ntohs(*reinterpret_cast<const uint16_t*>(this->data.data() + 2)) + sizeof(uint32_t);
+			}
+		}
+		if (result != 0 || extensionLength > decryptedSize) {
+			return {};
+		}
+		return std::basic_string_view<std::byte>{ this->data.data() + extensionLength, decryptedSize - extensionLength };
+	}
+
 	MovingAverager::MovingAverager(size_t collectionCountNew) noexcept {
 		this->collectionCount = collectionCountNew;
 	}
@@ -131,35 +450,13 @@ namespace DiscordCoreAPI {
 	}
 
 	VoiceConnectionBridge::VoiceConnectionBridge(DiscordCoreClient* clientPtrNew, std::basic_string<std::byte>& encryptionKeyNew,
-		StreamType streamType, Snowflake guildIdNew)
+		VoiceEncryptionMode encryptionMode, StreamType streamType, Snowflake guildIdNew)
 		: UDPConnection(streamType, clientPtrNew->getConfigManager().doWePrintWebSocketErrorMessages()) {
-		this->encryptionKey = encryptionKeyNew;
-		this->downSampledVector.resize(23040);
-		this->upSampledVector.resize(23040);
+		this->packetDecrypter = RTPPacketDecrypter{ encryptionKeyNew, encryptionMode };
 		this->clientPtr = clientPtrNew;
 		this->guildId = guildIdNew;
 	}
 
-	inline void VoiceConnectionBridge::collectEightElements(opus_int32* dataIn, opus_int16* dataOut) noexcept {
-		__m256 currentSamplesNew256{ _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_loadu_epi32(dataIn)),
-			_mm256_add_ps(_mm256_set1_ps(this->currentGain),
-				_mm256_mul_ps(_mm256_set1_ps(this->increment), _mm256_set_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f)))) };
-		__m256i currentSamplesNewer256{ _mm256_cvtps_epi32(_mm256_blendv_ps(
-			_mm256_max_ps(currentSamplesNew256, _mm256_set1_ps(static_cast<float>(std::numeric_limits<opus_int16>::min()))),
-			_mm256_min_ps(currentSamplesNew256, _mm256_set1_ps(static_cast<float>(std::numeric_limits<opus_int16>::max()))),
-			_mm256_cmp_ps(currentSamplesNew256, _mm256_set1_ps(0.0f), _CMP_GE_OQ))) };
-		_mm_storeu_epi16(dataOut,
-			_mm_packs_epi32(_mm256_extractf128_si256(currentSamplesNewer256, 0), _mm256_extractf128_si256(currentSamplesNewer256, 1)));
-	}
-
-	inline void VoiceConnectionBridge::applyGainRamp(int64_t sampleCount) noexcept {
-		this->increment = (this->endGain - this->currentGain) / static_cast<float>(sampleCount);
-		for (int64_t x = 0; x < sampleCount / 8; ++x) {
-			this->collectEightElements(this->upSampledVector.data() + (x * 8), this->downSampledVector.data() + (x * 8));
-			this->currentGain += this->increment * 8.0f;
-		}
-	}
-
 	void VoiceConnectionBridge::parseOutgoingVoiceData() noexcept {
 		std::basic_string_view<std::byte> buffer = this->getInputBuffer();
 		if (buffer == reinterpret_cast<const std::byte*>("goodbye")) {
@@ -178,69 +475,26 @@ namespace DiscordCoreAPI {
 	}
 
 	void VoiceConnectionBridge::mixAudio() noexcept {
-		opus_int32 voiceUserCountReal{};
-		int64_t decodedSize{};
-		std::fill(this->upSampledVector.data(), this->upSampledVector.data() + this->upSampledVector.size(), 0);
+		uint64_t speakerCount{};
+		this->mixer.beginFrame();
 		for (auto& [key, value]: this->clientPtr->getVoiceConnection(this->guildId)->voiceUsers) {
-			std::basic_string_view<std::byte> payload{ value->extractPayload() };
-			if (payload.size() == 0) {
-				continue;
-			} else {
-				const uint64_t headerSize{ 12 };
-				const uint64_t csrcCount{ static_cast<uint64_t>(payload[0]) & 0b0000'1111 };
-				const uint64_t offsetToData{ headerSize + sizeof(uint32_t) * csrcCount };
-				const uint64_t encryptedDataLength{ payload.size() - offsetToData };
-
-				if (this->decryptedDataString.size() < encryptedDataLength) {
-					this->decryptedDataString.resize(encryptedDataLength);
-				}
-
-				std::byte nonce[24]{};
-				for (int32_t x = 0; x < headerSize; ++x) {
-					nonce[x] = payload[x];
-				}
-
-				if (crypto_secretbox_open_easy(reinterpret_cast<uint8_t*>(this->decryptedDataString.data()),
-						reinterpret_cast<const uint8_t*>(payload.data()) + offsetToData, encryptedDataLength,
-						reinterpret_cast<uint8_t*>(nonce), reinterpret_cast<uint8_t*>(this->encryptionKey.data()))) {
-					continue;
-				}
-
-				std::basic_string_view newString{ this->decryptedDataString.data(), encryptedDataLength - crypto_secretbox_MACBYTES };
-
-				if (static_cast<int8_t>(payload[0] >> 4) & 0b0001) {
-					const uint16_t extenstionLengthInWords{ ntohs(*reinterpret_cast<const uint16_t*>(&newString[2])) };
-					const size_t extensionLength{ sizeof(uint32_t) * extenstionLengthInWords };
-					const size_t extensionHeaderLength{ sizeof(uint16_t) * 2 };
-					newString = newString.substr(extensionHeaderLength + extensionLength);
-				}
-
-				if (newString.size() > 0) {
-					std::basic_string_view<opus_int16> decodedData{};
-					try {
-						decodedData = value->getDecoder().decodeData(newString);
-					} catch (...) {
-						reportException("VoiceConnection::mixAudio()");
-					}
-					if (decodedData.size() > 0) {
-						decodedSize = std::max(decodedSize, static_cast<int64_t>(decodedData.size()));
-						++voiceUserCountReal;
-						for (size_t x = 0; x < decodedData.size() / 8; ++x) {
-							_mm256_storeu_epi32(this->upSampledVector.data() + (x * 8),
-								_mm256_add_epi32(_mm256_loadu_epi32(this->upSampledVector.data() + (x * 8)),
-									_mm256_cvtepi16_epi32(_mm_loadu_epi16(decodedData.data() + (x * 8)))));
-						}
-					}
-				}
+			std::basic_string_view<opus_int16> decodedData{};
+			try {
+				decodedData = value->decodeNextFrame(this->packetDecrypter);
+			} catch (...) {
+				reportException("VoiceConnection::mixAudio()");
+			}
+			if (decodedData.size() > 0) {
+				this->mixer.addSpeaker(decodedData, value->getGain());
+				++speakerCount;
 			}
 		}
-		if (decodedSize > 0) {
-			this->voiceUserCountAverage.insertValue(voiceUserCountReal);
-			this->endGain = 1.0f / this->voiceUserCountAverage.getCurrentValue();
-			this->applyGainRamp(decodedSize);
-			this->writeData(std::basic_string_view<std::byte>{ reinterpret_cast<std::byte*>(this->downSampledVector.data()),
-				static_cast<size_t>(decodedSize * 2) });
-			this->currentGain = this->endGain;
+		if (speakerCount > 0) {
+			std::basic_string_view<opus_int16> mixedData{ this->mixer.endFrame() };
+			this->writeData(std::basic_string_view<std::byte>{ reinterpret_cast<const std::byte*>(mixedData.data()),
+				mixedData.size() * sizeof(opus_int16) });
+		} else {
+			this->mixer.reset();
 		}
 	}
 
@@ -261,6 +515,63 @@ namespace DiscordCoreAPI {
 		return this->voiceConnectInitData.channelId;
 	}
 
+	std::vector<VoiceUserStats> VoiceConnection::getVoiceUserStats() noexcept {
+		std::vector<VoiceUserStats> returnValues{};
+		std::unique_lock<std::recursive_mutex> lock{};
+		if (auto worker = this->voiceEngineWorker; worker) {
+			lock = std::unique_lock{ worker->accessMutex };
+		}
+		for (auto& [key, value]: this->voiceUsers) {
+			returnValues.emplace_back(value->getStats());
+		}
+		return returnValues;
+	}
+
+	VoicePacingStats VoiceConnection::getPacingStats() noexcept {
+		std::unique_lock<std::recursive_mutex> lock{};
+		if (auto worker = this->voiceEngineWorker; worker) {
+			lock = std::unique_lock{ worker->accessMutex };
+		}
+		return this->pacingStats;
+	}
+
+	void VoiceConnection::setVoiceUserGain(Snowflake userId, float gain) noexcept {
+		std::unique_lock<std::recursive_mutex> lock{};
+		if (auto worker = this->voiceEngineWorker; worker) {
+			lock = std::unique_lock{ worker->accessMutex };
+		}
+		this->voiceUserGains[userId.operator size_t()] = gain;
+		for (auto& [key, value]: this->voiceUsers) {
+			if (value->getUserId() == userId) {
+				value->setGain(gain);
+			}
+		}
+	}
+
+	void VoiceConnection::addVoiceUser(uint32_t ssrc, Snowflake userId) noexcept {
+		if (this->voiceConnectInitData.streamInfo.type == StreamType::None || this->voiceUsers.contains(ssrc)) {
+			return;
+		}
+		if (!this->voiceConnectInitData.streamInfo.streamBotAudio) {
+			auto cachedUser = Users::getCachedUserView({ .userId = userId });
+			if (cachedUser && getBool(cachedUser->flags, UserFlags::Bot)) {
+				return;
+			}
+		}
+		std::unique_ptr<VoiceUser> user{ std::make_unique<VoiceUser>(userId, &this->decoderPool) };
+		if (this->voiceUserGains.contains(userId.operator size_t())) {
+			user->setGain(this->voiceUserGains[userId.operator size_t()]);
+		}
+		this->voiceUsers.emplace(std::make_pair(ssrc, std::move(user)));
+	}
+
+	std::unique_lock<std::recursive_mutex> VoiceConnection::lockVoiceEngineWorker() noexcept {
+		if (auto worker = this->voiceEngineWorker) {
+			return std::unique_lock<std::recursive_mutex>{ worker->accessMutex };
+		}
+		return std::unique_lock<std::recursive_mutex>{};
+	}
+
 	void VoiceConnection::parseIncomingVoiceData(std::basic_string_view<std::byte> rawDataBufferNew) noexcept {
 		if (rawDataBufferNew.size() <= 39) {
 			return;
@@ -277,14 +588,17 @@ namespace DiscordCoreAPI {
 
 	void VoiceConnection::connect(const VoiceConnectInitData& initData) noexcept {
 		this->voiceConnectInitData = initData;
+		try {
+			this->encoder.setOptions(initData.encoderOptions);
+		} catch (...) {
+			reportException("VoiceConnection::connect()");
+		}
 		this->connections = std::make_unique<ConnectionPackage>();
 		this->connections->currentReconnectTries = this->currentReconnectTries;
 		this->connections->currentShard = this->shard[0];
 		this->activeState.store(VoiceActiveState::Connecting);
-		if (!this->taskThread01) {
-			this->taskThread01 = std::make_unique<std::jthread>([=, this](std::stop_token token) {
-				this->runVoice(token);
-			});
+		if (!this->voiceEngineWorker && this->discordCoreClient->voiceEngine) {
+			this->discordCoreClient->voiceEngine->addConnection(this);
 		}
 		StopWatch stopWatch{ 15000us };
 		while (!WebSocketCore::areWeStillConnected() && !stopWatch.hasTimePassed()) {
@@ -387,6 +701,7 @@ namespace DiscordCoreAPI {
 				this->voiceIp = data.ip;
 				this->port = data.port;
 				this->audioEncryptionMode = data.mode;
+				this->encryptionMode = data.encryptionMode;
 				this->connectionState.store(VoiceConnectionState::Initializing_DatagramSocket);
 				break;
 			}
@@ -400,19 +715,18 @@ namespace DiscordCoreAPI {
 					}
 					this->encryptionKey = secretKey;
 				}
-				this->packetEncrypter = RTPPacketEncrypter{ this->audioSSRC, this->encryptionKey };
+				std::string modeName{ getString(value["d"], "mode") };
+				if (modeName != "") {
+					this->encryptionMode = RTPPacketEncrypter::getEncryptionMode(modeName);
+					this->audioEncryptionMode = modeName;
+				}
+				this->packetEncrypter = RTPPacketEncrypter{ this->audioSSRC, this->encryptionKey, this->encryptionMode };
 				this->connectionState.store(VoiceConnectionState::Collecting_Init_Data);
 				break;
 			}
 			case VoiceSocketOpCodes::Speaking: {
-				const uint32_t ssrc = getUint32(value["d"], "ssrc");
-				std::unique_ptr<VoiceUser> user{ std::make_unique<VoiceUser>(stoull(getString(value["d"], "user_id"))) };
-				if (!Users::getCachedUser({ .userId = user->getUserId() }).getFlagValue(UserFlags::Bot) ||
-					this->voiceConnectInitData.streamInfo.streamBotAudio) {
-					if (!this->voiceUsers.contains(ssrc)) {
-						this->voiceUsers.emplace(std::make_pair(ssrc, std::move(user)));
-					}
-				}
+				auto lock = this->lockVoiceEngineWorker();
+				this->addVoiceUser(getUint32(value["d"], "ssrc"), stoull(getString(value["d"], "user_id")));
 				break;
 			}
 			case VoiceSocketOpCodes::Heartbeat_ACK: {
@@ -433,6 +747,7 @@ namespace DiscordCoreAPI {
 			}
 			case VoiceSocketOpCodes::Client_Disconnect: {
 				const auto userId = stoull(getString(value["d"], "user_id"));
+				auto lock = this->lockVoiceEngineWorker();
 				for (auto& [key, value]: this->voiceUsers) {
 					if (userId == value->getUserId()) {
 						this->voiceUsers.erase(key);
@@ -595,7 +910,7 @@ namespace DiscordCoreAPI {
 				this->connectionState.store(VoiceConnectionState::Collecting_Init_Data);
 				if (this->voiceConnectInitData.streamInfo.type != StreamType::None) {
 					this->streamSocket = std::make_unique<VoiceConnectionBridge>(this->discordCoreClient, this->encryptionKey,
-						this->voiceConnectInitData.streamInfo.type, this->voiceConnectInitData.guildId);
+						this->encryptionMode, this->voiceConnectInitData.streamInfo.type, this->voiceConnectInitData.guildId);
 					if (!this->streamSocket->connect(this->voiceConnectInitData.streamInfo.address,
 							this->voiceConnectInitData.streamInfo.port, token)) {
 						++this->currentReconnectTries;
@@ -610,202 +925,189 @@ namespace DiscordCoreAPI {
 		}
 	}
 
-	void VoiceConnection::runVoice(std::stop_token token) noexcept {
-		StopWatch stopWatch{ 20000ms };
-		StopWatch sendSilenceStopWatch{ 5000ms };
-		while (!token.stop_requested() && !this->doWeQuit->load() && this->activeState.load() != VoiceActiveState::Exiting) {
-			switch (this->activeState.load()) {
-				case VoiceActiveState::Connecting: {
-					while (!token.stop_requested() && this->activeState.load() == VoiceActiveState::Connecting) {
-						std::this_thread::sleep_for(1ms);
-						if (!token.stop_requested() && VoiceConnection::areWeConnected()) {
-							if (WebSocketCore::processIO(10) == DiscordCoreInternal::ProcessIOResult::Error) {
-								this->onClosed();
-							}
-						}
-						if (!token.stop_requested() && VoiceConnection::areWeConnected()) {
-							this->checkForAndSendHeartBeat(false);
-						}
-						this->checkForConnections(token);
+	void VoiceConnection::startHandshake() noexcept {
+		if (this->handshakeThread) {
+			this->handshakeThread.reset(nullptr);
+		}
+		this->areWeHandshaking.store(true);
+		this->handshakeThread = std::make_unique<std::jthread>([=, this](std::stop_token token) {
+			this->checkForConnections(token);
+			this->datagramStopWatch.resetTimer();
+			this->areWeHandshaking.store(false);
+		});
+	}
+
+	bool VoiceConnection::collectPendingAudio() noexcept {
+		const uint64_t bytesPerPacket{ static_cast<uint64_t>(this->samplesPerPacket) * 4 };
+		auto songAPI = this->discordCoreClient->getSongAPI(this->voiceConnectInitData.guildId);
+		while (this->pendingAudio.size() - this->pendingAudioOffset < bytesPerPacket) {
+			if (!songAPI->audioDataBuffer.tryReceive(this->xferAudioData)) {
+				return false;
+			}
+			if (this->xferAudioData.type == AudioFrameType::Skip) {
+				const Snowflake guildMemberId{ this->currentGuildMemberId };
+				const Snowflake guildId{ this->voiceConnectInitData.guildId };
+				TimeElapsedHandlerNoArgs onSkip = [=]() {
+					SongCompletionEventData completionEventData{};
+					completionEventData.guild = Guilds::getCachedGuild({ .guildId = guildId });
+					if (guildMemberId != 0) {
+						completionEventData.guildMember =
+							GuildMembers::getCachedGuildMember({ .guildMemberId = guildMemberId, .guildId = guildId });
 					}
-					break;
+					completionEventData.wasItAFail = false;
+					DiscordCoreClient::getSongAPI(guildId)->onSongCompletionEvent(completionEventData);
+				};
+				ThreadPool::executeFunctionAfterTimePeriod(onSkip, 0, false);
+				this->xferAudioData.type = AudioFrameType::Unset;
+				this->xferAudioData.clearData();
+				this->pendingAudio.clear();
+				this->pendingAudioOffset = 0;
+				return false;
+			}
+			if (this->xferAudioData.type == AudioFrameType::Encoded && this->xferAudioData.currentSize > 0) {
+				this->pendingEncodedFrame.assign(this->xferAudioData.data.data(), static_cast<uint64_t>(this->xferAudioData.currentSize));
+				this->currentGuildMemberId = this->xferAudioData.guildMemberId;
+				this->xferAudioData.clearData();
+				this->pendingAudio.clear();
+				this->pendingAudioOffset = 0;
+				return true;
+			}
+			if (this->xferAudioData.type == AudioFrameType::RawPCM && this->xferAudioData.currentSize > 0 &&
+				this->xferAudioData.currentSize % 480 == 0) {
+				if (this->pendingAudioOffset > 0) {
+					this->pendingAudio.erase(0, this->pendingAudioOffset);
+					this->pendingAudioOffset = 0;
 				}
-				case VoiceActiveState::Stopped: {
+				this->pendingAudio.append(this->xferAudioData.data.data(), static_cast<uint64_t>(this->xferAudioData.currentSize));
+				this->currentGuildMemberId = this->xferAudioData.guildMemberId;
+			}
+			this->xferAudioData.clearData();
+		}
+		return true;
+	}
+
+	void VoiceConnection::prepareVoiceFrame() noexcept {
+		if (this->areWeHandshaking.load() || this->doWeQuit->load()) {
+			return;
+		}
+		if (this->connections) {
+			this->startHandshake();
+			return;
+		}
+		const VoiceActiveState currentActiveState{ this->activeState.load() };
+		if (currentActiveState == VoiceActiveState::Exiting) {
+			return;
+		}
+		if (VoiceConnection::areWeConnected()) {
+			this->checkForAndSendHeartBeat(false);
+		}
+		switch (currentActiveState) {
+			case VoiceActiveState::Connecting: {
+				break;
+			}
+			case VoiceActiveState::Stopped: {
+				if (this->lastActiveState != VoiceActiveState::Stopped) {
 					this->areWePlaying.store(false);
-					this->discordCoreClient->getSongAPI(this->voiceConnectInitData.guildId)->audioDataBuffer.clearContents();
 					this->clearAudioData();
-					while (!token.stop_requested() && this->activeState.load() == VoiceActiveState::Stopped) {
-						UDPConnection::processIO(DiscordCoreInternal::ProcessIOType::Both);
-						std::this_thread::sleep_for(1ms);
-						if (!token.stop_requested() && VoiceConnection::areWeConnected()) {
-							if (WebSocketCore::processIO(10) == DiscordCoreInternal::ProcessIOResult::Error) {
-								this->onClosed();
-							}
-						}
-						if (!token.stop_requested() && VoiceConnection::areWeConnected()) {
-							this->checkForAndSendHeartBeat(false);
-						}
-						this->checkForConnections(token);
-					}
-					break;
 				}
-				case VoiceActiveState::Paused: {
-					this->areWePlaying.store(false);
-					while (!token.stop_requested() && this->activeState.load() == VoiceActiveState::Paused) {
-						UDPConnection::processIO(DiscordCoreInternal::ProcessIOType::Both);
-						std::this_thread::sleep_for(1ms);
-						if (!token.stop_requested() && VoiceConnection::areWeConnected()) {
-							if (WebSocketCore::processIO(10) == DiscordCoreInternal::ProcessIOResult::Error) {
-								this->onClosed();
-							}
-						}
-						if (!token.stop_requested() && VoiceConnection::areWeConnected()) {
-							this->checkForAndSendHeartBeat(false);
-						}
-						this->checkForConnections(token);
+				break;
+			}
+			case VoiceActiveState::Paused: {
+				this->areWePlaying.store(false);
+				break;
+			}
+			case VoiceActiveState::Playing: {
+				if (!UDPConnection::areWeStillConnected()) {
+					if (this->datagramStopWatch.hasTimePassed()) {
+						this->datagramStopWatch.resetTimer();
+						this->onClosed();
 					}
-					break;
+					return;
 				}
-				case VoiceActiveState::Playing: {
+				if (this->lastActiveState != VoiceActiveState::Playing) {
 					this->xferAudioData.type = AudioFrameType::Unset;
-					this->xferAudioData.data.clear();
-
-					stopWatch.resetTimer();
-					while (!token.stop_requested() && !UDPConnection::areWeStillConnected()) {
-						if (stopWatch.hasTimePassed() || this->activeState.load() == VoiceActiveState::Exiting) {
-							return;
-						}
-						std::this_thread::sleep_for(1ms);
-						if (!token.stop_requested() && VoiceConnection::areWeConnected()) {
-							if (WebSocketCore::processIO(10) == DiscordCoreInternal::ProcessIOResult::Error) {
-								this->onClosed();
-							}
-						}
-						if (!token.stop_requested() && VoiceConnection::areWeConnected()) {
-							this->checkForAndSendHeartBeat(false);
-						}
-						this->checkForConnections(token);
-					}
-
-					auto targetTime{ HRClock::now() + this->intervalCount };
+					this->xferAudioData.clearData();
 					this->sendSpeakingMessage(false);
 					this->sendSpeakingMessage(true);
-
-					while (!token.stop_requested() && this->activeState.load() == VoiceActiveState::Playing) {
-						int64_t bytesPerSample{ 4 };
-						if (!token.stop_requested() && VoiceConnection::areWeConnected()) {
-							this->checkForAndSendHeartBeat(false);
-						}
-						this->checkForConnections(token);
-						this->discordCoreClient->getSongAPI(this->voiceConnectInitData.guildId)
-							->audioDataBuffer.tryReceive(this->xferAudioData);
-						AudioFrameType frameType{ this->xferAudioData.type };
-						if (this->xferAudioData.currentSize % 480 != 0 || this->xferAudioData.currentSize == 0) {
-							this->areWePlaying.store(false);
-							this->xferAudioData.clearData();
-						} else {
-							this->intervalCount =
-								Nanoseconds{ static_cast<uint64_t>(static_cast<double>(this->xferAudioData.currentSize / bytesPerSample) /
-									static_cast<double>(this->sampleRatePerSecond) * static_cast<double>(this->nsPerSecond)) };
-							this->areWePlaying.store(true);
-							this->audioData.writeData(static_cast<std::basic_string_view<std::byte>>(this->xferAudioData.data));
-							this->currentGuildMemberId = this->xferAudioData.guildMemberId;
-						}
-						std::basic_string_view<std::byte> frame{};
-						bool doWeBreak{};
-						switch (frameType) {
-							case AudioFrameType::RawPCM: {
-								if (this->audioData.getCurrentTail()->getUsedSpace() >=
-									static_cast<uint64_t>(this->samplesPerPacket * bytesPerSample)) {
-									auto encodedFrameData = this->encoder.encodeData(this->audioData.readData());
-									if (encodedFrameData.data.size() != 0) {
-										frame = this->packetEncrypter.encryptPacket(encodedFrameData);
-									}
-								}
-								break;
-							}
-							case AudioFrameType::Skip: {
-								SongCompletionEventData completionEventData{};
-								completionEventData.guild = Guilds::getCachedGuild({ .guildId = this->voiceConnectInitData.guildId });
-								if (this->currentGuildMemberId != 0) {
-									completionEventData.guildMember = GuildMembers::getCachedGuildMember(
-										{ .guildMemberId = this->currentGuildMemberId, .guildId = this->voiceConnectInitData.guildId });
-								}
-								completionEventData.wasItAFail = false;
-								DiscordCoreClient::getSongAPI(this->voiceConnectInitData.guildId)
-									->onSongCompletionEvent(completionEventData);
-								this->areWePlaying.store(false);
-								doWeBreak = true;
-								this->xferAudioData.type = AudioFrameType::Unset;
-								this->xferAudioData.clearData();
-								this->audioData.clear();
-								break;
-							}
-							case AudioFrameType::Unset: {
-								this->sendSilence();
-								break;
-							}
-						}
-						if (doWeBreak) {
-							continue;
-						}
-						auto waitTime = targetTime - HRClock::now();
-						auto waitTimeCount = waitTime.count();
-						int64_t minimumFreeTimeForCheckingProcessIO{ static_cast<int64_t>(
-							static_cast<double>(this->intervalCount.count()) * 0.70l) };
-						if (waitTimeCount >= minimumFreeTimeForCheckingProcessIO && !token.stop_requested() &&
-							VoiceConnection::areWeConnected()) {
-							if (WebSocketCore::processIO(0) == DiscordCoreInternal::ProcessIOResult::Error) {
-								this->onClosed();
-							}
-						}
-
-						waitTime = targetTime - HRClock::now();
-						waitTimeCount = static_cast<int64_t>(static_cast<double>(waitTime.count()) * 0.95l);
-						if (waitTimeCount > 0) {
-							nanoSleep(waitTimeCount);
-						}
-						waitTime = targetTime - HRClock::now();
-						waitTimeCount = waitTime.count();
-						if (waitTimeCount > 0 && waitTimeCount < this->intervalCount.count()) {
-							spinLock(waitTimeCount);
-						}
-						if (frame.size() > 0) {
-							this->xferAudioData.clearData();
-							UDPConnection::writeData(frame);
-							if (UDPConnection::processIO(DiscordCoreInternal::ProcessIOType::Both) ==
-								DiscordCoreInternal::ProcessIOResult::Error) {
-								this->onClosed();
-							}
+				}
+				if (this->collectPendingAudio()) {
+					if (this->pendingEncodedFrame.size() > 0) {
+						DiscordCoreInternal::EncoderReturnData encodedFrameData{};
+						encodedFrameData.data = this->pendingEncodedFrame;
+						encodedFrameData.sampleCount = static_cast<size_t>(this->samplesPerPacket);
+						UDPConnection::writeData(this->packetEncrypter.encryptPacket(encodedFrameData));
+						this->pendingEncodedFrame.clear();
+						this->isPacketPending = true;
+					} else {
+						const uint64_t bytesPerPacket{ static_cast<uint64_t>(this->samplesPerPacket) * 4 };
+						auto encodedFrameData =
+							this->encoder.encodeData({ this->pendingAudio.data() + this->pendingAudioOffset, bytesPerPacket });
+						this->pendingAudioOffset += bytesPerPacket;
+						if (encodedFrameData.data.size() != 0) {
+							UDPConnection::writeData(this->packetEncrypter.encryptPacket(encodedFrameData));
+							this->isPacketPending = true;
 						} else {
-							if (UDPConnection::processIO(DiscordCoreInternal::ProcessIOType::Read_Only) ==
-								DiscordCoreInternal::ProcessIOResult::Error) {
-								this->onClosed();
-							}
-						}
-
-						targetTime = HRClock::now() + this->intervalCount;
-
-						if (this->streamSocket && this->streamSocket->areWeStillConnected()) {
-							this->streamSocket->mixAudio();
-							if (this->streamSocket->processIO(DiscordCoreInternal::ProcessIOType::Both) ==
-								DiscordCoreInternal::ProcessIOResult::Error) {
-								this->onClosed();
-							}
+							this->packetEncrypter.skipFrame(encodedFrameData.sampleCount);
 						}
 					}
-					break;
-				}
-				case VoiceActiveState::Exiting: {
-					return;
+					this->areWePlaying.store(true);
+				} else if (this->areWePlaying.load()) {
+					this->areWePlaying.store(false);
+					this->sendSilence();
 				}
+				break;
 			}
-			if (token.stop_requested() || this->activeState == VoiceActiveState::Exiting) {
+			case VoiceActiveState::Exiting: {
 				return;
 			}
-			std::this_thread::sleep_for(1ms);
 		}
-	};
+		this->lastActiveState = currentActiveState;
+	}
+
+	void VoiceConnection::flushVoiceFrame(SteadyClock::time_point deadline) noexcept {
+		const bool wasPacketPending{ std::exchange(this->isPacketPending, false) };
+		if (this->areWeHandshaking.load() || !UDPConnection::areWeStillConnected()) {
+			return;
+		}
+		if (UDPConnection::processIO(DiscordCoreInternal::ProcessIOType::Both) == DiscordCoreInternal::ProcessIOResult::Error) {
+			this->onClosed();
+			return;
+		}
+		if (wasPacketPending) {
+			this->recordPacketSent(deadline, SteadyClock::now());
+		}
+		if (this->activeState.load() == VoiceActiveState::Playing && this->streamSocket && this->streamSocket->areWeStillConnected()) {
+			this->streamSocket->mixAudio();
+			if (this->streamSocket->processIO(DiscordCoreInternal::ProcessIOType::Both) == DiscordCoreInternal::ProcessIOResult::Error) {
+				this->onClosed();
+			}
+		}
+	}
+
+	void VoiceConnection::recordPacketSent(SteadyClock::time_point deadline, SteadyClock::time_point sendTime) noexcept {
+		const float latenessMs{ std::chrono::duration<float, std::milli>(sendTime - deadline).count() };
+		if (this->pacingStats.packetsSent > 0) {
+			const float spacingMs{ std::chrono::duration<float, std::milli>(sendTime - this->lastPacketSendTime).count() };
+			const float expectedSpacingMs{ std::chrono::duration<float, std::milli>(deadline - this->lastPacketDeadline).count() };
+			this->pacingStats.jitterMs += (std::abs(spacingMs - expectedSpacingMs) - this->pacingStats.jitterMs) / 16.0f;
+		}
+		this->pacingStats.latenessMs += (latenessMs - this->pacingStats.latenessMs) / 16.0f;
+		this->pacingStats.maxLatenessMs = std::max(this->pacingStats.maxLatenessMs, latenessMs);
+		if (latenessMs > VoicePacingStats::lateThresholdMs) {
+			++this->pacingStats.packetsLate;
+		}
+		++this->pacingStats.packetsSent;
+		this->lastPacketDeadline = deadline;
+		this->lastPacketSendTime = sendTime;
+	}
+
+	void VoiceConnection::processControlSocket() noexcept {
+		if (!this->areWeHandshaking.load() && WebSocketCore::areWeStillConnected()) {
+			if (WebSocketCore::processIO(0) == DiscordCoreInternal::ProcessIOResult::Error) {
+				this->onClosed();
+			}
+		}
+	}
 
 	bool VoiceConnection::areWeCurrentlyPlaying() noexcept {
 		return (this->areWePlaying.load() && this->activeState.load() == VoiceActiveState::Playing) ||
@@ -826,6 +1128,9 @@ namespace DiscordCoreAPI {
 		if (this->xferAudioData.data.size() != 0) {
 			this->xferAudioData.clearData();
 		}
+		this->pendingEncodedFrame.clear();
+		this->pendingAudio.clear();
+		this->pendingAudioOffset = 0;
 		this->discordCoreClient->getSongAPI(this->voiceConnectInitData.guildId)->audioDataBuffer.clearContents();
 	}
 
@@ -889,8 +1194,8 @@ namespace DiscordCoreAPI {
 		}
 		for (auto& value: frames) {
 			UDPConnection::writeData(value);
-			UDPConnection::processIO(DiscordCoreInternal::ProcessIOType::Both);
 		}
+		UDPConnection::processIO(DiscordCoreInternal::ProcessIOType::Both);
 	}
 
 	void VoiceConnection::pauseToggle() noexcept {
@@ -903,19 +1208,26 @@ namespace DiscordCoreAPI {
 
 	void VoiceConnection::disconnect() noexcept {
 		this->activeState.store(VoiceActiveState::Exiting);
+		if (this->voiceEngine) {
+			this->voiceEngine->removeConnection(this);
+		}
+		if (this->handshakeThread) {
+			this->handshakeThread->request_stop();
+			if (this->handshakeThread->get_id() == std::this_thread::get_id()) {
+				this->handshakeThread->detach();
+			} else if (this->handshakeThread->joinable()) {
+				this->handshakeThread->join();
+			}
+			this->handshakeThread.reset(nullptr);
+		}
+		this->areWeHandshaking.store(false);
+		this->lastActiveState = VoiceActiveState::Connecting;
 		std::string payload = "\x03\xE8";
 		this->createHeader(payload, DiscordCoreInternal::WebSocketOpCode::Op_Close);
 		WebSocketCore::writeData(payload, true);
 		WebSocketCore::outputBuffer.clear();
 		WebSocketCore::inputBuffer.clear();
 		WebSocketCore::socket = SOCKET_ERROR;
-		if (this->taskThread01) {
-			this->taskThread01->request_stop();
-			if (this->taskThread01->joinable()) {
-				this->taskThread01->join();
-				this->taskThread01.reset(nullptr);
-			}
-		}
 		WebSocketCore::ssl = nullptr;
 		UDPConnection::disconnect();
 		if (this->streamSocket) {
@@ -967,4 +1279,246 @@ namespace DiscordCoreAPI {
 		this->disconnect();
 	}
 
-}
\ No newline at end of file
+}
+
+namespace DiscordCoreInternal {
+
+	VoiceEngine::VoiceEngine(uint32_t threadCount) {
+		if (threadCount == 0) {
+			threadCount = std::max(std::thread::hardware_concurrency() / 4, 1u);
+		}
+		for (uint32_t x = 0; x < threadCount; ++x) {
+			this->workers.emplace_back(std::make_unique<VoiceEngineWorker>());
+			VoiceEngineWorker* worker{ this->workers.back().get() };
+#ifdef __linux__
+			worker->pollHandle = epoll_create1(EPOLL_CLOEXEC);
+#endif
+			worker->thread = std::jthread([=, this](std::stop_token token) {
+				this->run(*worker, token);
+			});
+		}
+	}
+
+	void VoiceEngine::addConnection(DiscordCoreAPI::VoiceConnection* connection) noexcept {
+		if (connection->voiceEngineWorker) {
+			return;
+		}
+		VoiceEngineWorker* leastLoadedWorker{ nullptr };
+		uint64_t leastConnectionCount{ std::numeric_limits<uint64_t>::max() };
+		for (auto& value: this->workers) {
+			std::unique_lock lock{ value->accessMutex };
+			if (value->connections.size() < leastConnectionCount) {
+				leastConnectionCount = value->connections.size();
+				leastLoadedWorker = value.get();
+			}
+		}
+		if (leastLoadedWorker) {
+			std::unique_lock lock{ leastLoadedWorker->accessMutex };
+			leastLoadedWorker->connections.emplace_back(connection);
+			leastLoadedWorker->controlSockets[connection] = INVALID_SOCKET;
+			connection->voiceEngineWorker = leastLoadedWorker;
+			connection->voiceEngine = this;
+		}
+	}
+
+	void VoiceEngine::removeConnection(DiscordCoreAPI::VoiceConnection* connection) noexcept {
+		VoiceEngineWorker* worker{ connection->voiceEngineWorker };
+		if (!worker) {
+			return;
+		}
+		std::unique_lock lock{ worker->accessMutex };
+		for (auto& value: worker->connections) {
+			if (value == connection) {
+				value = nullptr;
+			}
+		}
+#ifdef __linux__
+		if (auto socket = worker->controlSockets.find(connection);
+			worker->pollHandle != -1 && socket != worker->controlSockets.end() && socket->second != INVALID_SOCKET) {
+			epoll_ctl(worker->pollHandle, EPOLL_CTL_DEL, socket->second, nullptr);
+		}
+#endif
+		worker->controlSockets.erase(connection);
+		connection->voiceEngineWorker = nullptr;
+		connection->voiceEngine = nullptr;
+	}
+
+	void VoiceEngine::waitForControlEvents(VoiceEngineWorker& worker, SteadyClock::time_point deadline) noexcept {
+		int64_t msToWait{ std::chrono::duration_cast<Milliseconds>(deadline - SteadyClock::now()).count() };
+		while (msToWait > 0) {
+			std::vector<DiscordCoreAPI::VoiceConnection*> readyConnections{};
+#ifdef __linux__
+			if (worker.pollHandle != -1) {
+				epoll_event events[64]{};
+				int32_t eventCount{ epoll_wait(worker.pollHandle, events, static_cast<int32_t>(std::size(events)),
+					static_cast<int32_t>(msToWait)) };
+				if (eventCount < 0 && errno != EINTR) {
+					return;
+				}
+				for (int32_t x = 0; x < eventCount; ++x) {
+					readyConnections.emplace_back(static_cast<DiscordCoreAPI::VoiceConnection*>(events[x].data.ptr));
+				}
+			}
+#endif
+			if (worker.pollHandle == -1) {
+				std::vector<DiscordCoreAPI::VoiceConnection*> connections{};
+				std::vector<pollfd> polls{};
+				std::unique_lock lock{ worker.accessMutex };
+				for (auto& [key, value]: worker.controlSockets) {
+					if (value != INVALID_SOCKET) {
+						polls.emplace_back(pollfd{ .fd = value, .events = POLLIN, .revents = 0 });
+						connections.emplace_back(key);
+					}
+				}
+				lock.unlock();
+				if (polls.size() == 0) {
+					return;
+				}
+				if (poll(polls.data(), static_cast<uint32_t>(polls.size()), static_cast<int32_t>(msToWait)) == SOCKET_ERROR) {
+					return;
+				}
+				for (uint64_t x = 0; x < polls.size(); ++x) {
+					if (polls[x].revents != 0) {
+						readyConnections.emplace_back(connections[x]);
+					}
+				}
+			}
+			if (readyConnections.size() > 0) {
+				std::unique_lock lock{ worker.accessMutex };
+				for (auto& value: readyConnections) {
+					if (!worker.controlSockets.contains(value) || worker.controlSockets[value] == INVALID_SOCKET) {
+						continue;
+					}
+					value->processControlSocket();
+					if (value->connections && worker.controlSockets.contains(value)) {
+#ifdef __linux__
+						if (worker.pollHandle != -1) {
+							epoll_ctl(worker.pollHandle, EPOLL_CTL_DEL, worker.controlSockets[value], nullptr);
+						}
+#endif
+						worker.controlSockets[value] = INVALID_SOCKET;
+					}
+				}
+			}
+			msToWait = std::chrono::duration_cast<Milliseconds>(deadline - SteadyClock::now()).count();
+		}
+	}
+
+	void VoiceEngine::registerControlSockets(VoiceEngineWorker& worker) noexcept {
+		for (auto& value: worker.connections) {
+			if (!value || !worker.controlSockets.contains(value)) {
+				continue;
+			}
+			SOCKET currentSocket{ INVALID_SOCKET };
+			if (!value->areWeHandshaking.load() && !value->connections && value->WebSocketCore::areWeStillConnected()) {
+				currentSocket = value->WebSocketCore::socket;
+			}
+			if (worker.controlSockets[value] == currentSocket) {
+				continue;
+			}
+#ifdef __linux__
+			if (worker.pollHandle != -1 && worker.controlSockets[value] != INVALID_SOCKET) {
+				epoll_ctl(worker.pollHandle, EPOLL_CTL_DEL, worker.controlSockets[value], nullptr);
+			}
+#endif
+			worker.controlSockets[value] = currentSocket;
+#ifdef __linux__
+			if (worker.pollHandle != -1 && currentSocket != INVALID_SOCKET) {
+				epoll_event event{};
+				event.events = EPOLLIN;
+				event.data.ptr = value;
+				if (epoll_ctl(worker.pollHandle, EPOLL_CTL_ADD, currentSocket, &event) != 0 && errno == EEXIST) {
+					epoll_ctl(worker.pollHandle, EPOLL_CTL_MOD, currentSocket, &event);
+				}
+			}
+#endif
+		}
+	}
+
+	VoicePacingClock::VoicePacingClock(Nanoseconds intervalNew) noexcept {
+		this->epoch = SteadyClock::now() + intervalNew;
+		this->interval = intervalNew;
+	}
+
+	SteadyClock::time_point VoicePacingClock::getDeadline() const noexcept {
+		return this->epoch + this->interval * this->tickIndex;
+	}
+
+	uint64_t VoicePacingClock::collectDueTicks(SteadyClock::time_point now) noexcept {
+		if (now < this->getDeadline()) {
+			return 0;
+		}
+		uint64_t dueTicks{ static_cast<uint64_t>((now - this->epoch) / this->interval) + 1 - this->tickIndex };
+		if (dueTicks > maxCatchUpTicks + 1) {
+			this->skippedTicks += dueTicks - (maxCatchUpTicks + 1);
+			this->tickIndex += dueTicks - (maxCatchUpTicks + 1);
+			dueTicks = maxCatchUpTicks + 1;
+		}
+		return dueTicks;
+	}
+
+	void VoicePacingClock::advance() noexcept {
+		++this->tickIndex;
+	}
+
+	uint64_t VoicePacingClock::getSkippedTicks() const noexcept {
+		return this->skippedTicks;
+	}
+
+	void VoiceEngine::run(VoiceEngineWorker& worker, std::stop_token token) noexcept {
+#ifdef __linux__
+		prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+#endif
+		VoicePacingClock pacingClock{ this->tickInterval };
+		while (!token.stop_requested()) {
+			this->waitForControlEvents(worker, pacingClock.getDeadline());
+			std::this_thread::sleep_until(pacingClock.getDeadline());
+			const uint64_t skippedTicksPrevious{ pacingClock.getSkippedTicks() };
+			uint64_t dueTicks{ pacingClock.collectDueTicks(SteadyClock::now()) };
+			uint64_t skippedTicks{ pacingClock.getSkippedTicks() - skippedTicksPrevious };
+			for (; dueTicks > 0; --dueTicks) {
+				this->tick(worker, pacingClock.getDeadline(), std::exchange(skippedTicks, 0));
+				pacingClock.advance();
+			}
+		}
+	}
+
+	void VoiceEngine::tick(VoiceEngineWorker& worker, SteadyClock::time_point deadline, uint64_t skippedTicks) noexcept {
+		std::unique_lock lock{ worker.accessMutex };
+		for (uint64_t x = 0; x < worker.connections.size(); ++x) {
+			if (worker.connections[x]) {
+				worker.connections[x]->prepareVoiceFrame();
+			}
+		}
+		for (uint64_t x = 0; x < worker.connections.size(); ++x) {
+			if (worker.connections[x]) {
+				if (skippedTicks > 0 && worker.connections[x]->areWePlaying.load()) {
+					worker.connections[x]->pacingStats.ticksSkipped += skippedTicks;
+				}
+				worker.connections[x]->flushVoiceFrame(deadline);
+			}
+		}
+		this->registerControlSockets(worker);
+		std::erase(worker.connections, nullptr);
+	}
+
+	VoiceEngine::~VoiceEngine() noexcept {
+		for (auto& value: this->workers) {
+			value->thread.request_stop();
+			if (value->thread.joinable()) {
+				value->thread.join();
+			}
+			for (auto& connection: value->connections) {
+				if (connection) {
+					connection->voiceEngineWorker = nullptr;
+					connection->voiceEngine = nullptr;
+				}
+			}
+#ifdef __linux__
+			if (value->pollHandle != -1) {
+				close(value->pollHandle);
+			}
+#endif
+		}
+	}
+}
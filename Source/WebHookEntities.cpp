@@ -413,7 +413,7 @@ namespace DiscordCoreAPI {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
 			auto serializer = dataPackage.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
-			workload.content = constructMultiPartData(serializer.operator std::string(), dataPackage.files);
+			workload.setMultiPartContent(serializer.operator std::string(), dataPackage.files);
 		} else {
 			auto serializer = dataPackage.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
@@ -450,7 +450,7 @@ namespace DiscordCoreAPI {
 			workload.payloadType = DiscordCoreInternal::PayloadType::Multipart_Form;
 			auto serializer = dataPackage.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
-			workload.content = constructMultiPartData(serializer.operator std::string(), dataPackage.files);
+			workload.setMultiPartContent(serializer.operator std::string(), dataPackage.files);
 		} else {
 			auto serializer = dataPackage.operator Jsonifier();
 			serializer.refreshString(JsonifierSerializeType::Json);
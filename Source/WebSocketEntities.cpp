@@ -378,6 +378,438 @@ namespace DiscordCoreInternal {
 		}
 	}
 
+	GuildIngestionPipeline::GuildIngestionPipeline(DiscordCoreAPI::DiscordCoreClient* discordCoreClientNew, uint32_t threadCount) {
+		this->discordCoreClient = discordCoreClientNew;
+		for (uint32_t x = 0; x < threadCount; ++x) {
+			this->lanes.emplace_back(std::make_unique<GuildIngestionLane>());
+		}
+		for (auto& value: this->lanes) {
+			value->thread = std::jthread([=, this, lane = value.get()](std::stop_token token) {
+				this->run(token, *lane);
+			});
+		}
+	}
+
+	void GuildIngestionPipeline::expectGuilds(uint32_t shard, const std::vector<DiscordCoreAPI::Snowflake>& guildIds) {
+		GuildsReadyState state{};
+		state.guildCount = guildIds.size();
+		for (auto& value: guildIds) {
+			state.pendingGuilds.emplace(static_cast<uint64_t>(value));
+		}
+		if (state.pendingGuilds.empty()) {
+			DiscordCoreAPI::CacheSnapshots::finishReconciling(shard, this->discordCoreClient->configManager.getTotalShardCount());
+			DiscordCoreAPI::OnGuildsReadyData dataPackage{};
+			dataPackage.shardId = shard;
+			this->discordCoreClient->eventManager.onGuildsReadyEvent(dataPackage);
+			return;
+		}
+		std::unique_lock lock{ this->readyStateMutex };
+		this->readyStates.insert_or_assign(shard, std::move(state));
+	}
+
+	void GuildIngestionPipeline::submit(uint64_t guildId, uint32_t shard, std::string&& payload) {
+		auto& lane = *this->lanes[std::hash<uint64_t>{}(guildId) % this->lanes.size()];
+		std::unique_lock lock{ lane.accessMutex };
+		lane.spaceCondVar.wait(lock, [&] {
+			return this->doWeQuit.load() || lane.tasks.size() < GuildIngestionPipeline::laneCapacity;
+		});
+		if (this->doWeQuit.load()) {
+			return;
+		}
+		lane.tasks.emplace_back(GuildIngestionTask{ std::move(payload), shard });
+		lock.unlock();
+		lane.taskCondVar.notify_one();
+	}
+
+	void GuildIngestionPipeline::processGuildEvent(int32_t eventType, WebSocketMessage& message, simdjson::ondemand::value dValue,
+		uint32_t shard) {
+		auto& eventManager = this->discordCoreClient->eventManager;
+		switch (eventType) {
+			case 8: {
+				std::unique_ptr<DiscordCoreAPI::OnChannelCreationData> dataPackage{
+					std::make_unique<DiscordCoreAPI::OnChannelCreationData>(message, dValue)
+				};
+				if (eventManager.onChannelCreationEvent.functions.size() > 0) {
+					eventManager.onChannelCreationEvent(*dataPackage);
+				}
+				break;
+			}
+			case 9: {
+				std::unique_ptr<DiscordCoreAPI::OnChannelUpdateData> dataPackage{
+					std::make_unique<DiscordCoreAPI::OnChannelUpdateData>(message, dValue)
+				};
+				if (eventManager.onChannelUpdateEvent.functions.size() > 0) {
+					eventManager.onChannelUpdateEvent(*dataPackage);
+				}
+				break;
+			}
+			case 10: {
+				std::unique_ptr<DiscordCoreAPI::OnChannelDeletionData> dataPackage{
+					std::make_unique<DiscordCoreAPI::OnChannelDeletionData>(message, dValue)
+				};
+				if (eventManager.onChannelDeletionEvent.functions.size() > 0) {
+					eventManager.onChannelDeletionEvent(*dataPackage);
+				}
+				break;
+			}
+			case 12: {
+				if (eventManager.onThreadCreationEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnThreadCreationData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnThreadCreationData>(message, dValue)
+					};
+					eventManager.onThreadCreationEvent(*dataPackage);
+				}
+				break;
+			}
+			case 13: {
+				if (eventManager.onThreadUpdateEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnThreadUpdateData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnThreadUpdateData>(message, dValue)
+					};
+					eventManager.onThreadUpdateEvent(*dataPackage);
+				}
+				break;
+			}
+			case 14: {
+				if (eventManager.onThreadDeletionEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnThreadDeletionData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnThreadDeletionData>(message, dValue)
+					};
+					eventManager.onThreadDeletionEvent(*dataPackage);
+				}
+				break;
+			}
+			case 15: {
+				if (eventManager.onThreadListSyncEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnThreadListSyncData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnThreadListSyncData>(message, dValue)
+					};
+					eventManager.onThreadListSyncEvent(*dataPackage);
+				}
+				break;
+			}
+			case 16: {
+				if (eventManager.onThreadMemberUpdateEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnThreadMemberUpdateData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnThreadMemberUpdateData>(message, dValue)
+					};
+					eventManager.onThreadMemberUpdateEvent(*dataPackage);
+				}
+				break;
+			}
+			case 17: {
+				if (eventManager.onThreadMembersUpdateEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnThreadMembersUpdateData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnThreadMembersUpdateData>(message, dValue)
+					};
+					eventManager.onThreadMembersUpdateEvent(*dataPackage);
+				}
+				break;
+			}
+			case 18: {
+				uint64_t guildId{};
+				if (eventManager.onGuildCreationEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnGuildCreationData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnGuildCreationData>(message, dValue, this->discordCoreClient)
+					};
+					guildId = static_cast<uint64_t>(dataPackage->guild->id);
+					DiscordCoreAPI::CacheSnapshots::reconcileGuild(*dataPackage->guild);
+					eventManager.onGuildCreationEvent(*dataPackage);
+				} else {
+					DiscordCoreAPI::GuildData guild{ message.processJsonMessage<DiscordCoreAPI::GuildData>(dValue, "d") };
+					guildId = static_cast<uint64_t>(guild.id);
+					DiscordCoreAPI::CacheSnapshots::reconcileGuild(guild);
+					DiscordCoreAPI::Guilds::insertGuild(std::move(guild));
+				}
+				this->markGuildIngested(shard, guildId);
+				break;
+			}
+			case 19: {
+				std::unique_ptr<DiscordCoreAPI::OnGuildUpdateData> dataPackage{
+					std::make_unique<DiscordCoreAPI::OnGuildUpdateData>(message, dValue, this->discordCoreClient)
+				};
+				if (eventManager.onGuildUpdateEvent.functions.size() > 0) {
+					eventManager.onGuildUpdateEvent(*dataPackage);
+				}
+				break;
+			}
+			case 20: {
+				std::unique_ptr<DiscordCoreAPI::OnGuildDeletionData> dataPackage{
+					std::make_unique<DiscordCoreAPI::OnGuildDeletionData>(message, dValue, this->discordCoreClient)
+				};
+				this->markGuildIngested(shard, static_cast<uint64_t>(dataPackage->guild->id));
+				if (eventManager.onGuildDeletionEvent.functions.size() > 0) {
+					eventManager.onGuildDeletionEvent(*dataPackage);
+				}
+				break;
+			}
+			case 21: {
+				if (eventManager.onGuildBanAddEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnGuildBanAddData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnGuildBanAddData>(message, dValue)
+					};
+					eventManager.onGuildBanAddEvent(*dataPackage);
+				}
+				break;
+			}
+			case 22: {
+				if (eventManager.onGuildBanRemoveEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnGuildBanRemoveData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnGuildBanRemoveData>(message, dValue)
+					};
+					eventManager.onGuildBanRemoveEvent(*dataPackage);
+				}
+				break;
+			}
+			case 23: {
+				if (eventManager.onGuildEmojisUpdateEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnGuildEmojisUpdateData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnGuildEmojisUpdateData>(message, dValue)
+					};
+					eventManager.onGuildEmojisUpdateEvent(*dataPackage);
+				}
+				break;
+			}
+			case 24: {
+				if (eventManager.onGuildStickersUpdateEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnGuildStickersUpdateData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnGuildStickersUpdateData>(message, dValue)
+					};
+					eventManager.onGuildStickersUpdateEvent(*dataPackage);
+				}
+				break;
+			}
+			case 25: {
+				if (eventManager.onGuildIntegrationsUpdateEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnGuildIntegrationsUpdateData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnGuildIntegrationsUpdateData>(message, dValue)
+					};
+					eventManager.onGuildIntegrationsUpdateEvent(*dataPackage);
+				}
+				break;
+			}
+			case 26: {
+				std::unique_ptr<DiscordCoreAPI::OnGuildMemberAddData> dataPackage{
+					std::make_unique<DiscordCoreAPI::OnGuildMemberAddData>(message, dValue, this->discordCoreClient)
+				};
+				if (eventManager.onGuildMemberAddEvent.functions.size() > 0) {
+					eventManager.onGuildMemberAddEvent(*dataPackage);
+				}
+				break;
+			}
+			case 27: {
+				std::unique_ptr<DiscordCoreAPI::OnGuildMemberRemoveData> dataPackage{
+					std::make_unique<DiscordCoreAPI::OnGuildMemberRemoveData>(message, dValue, this->discordCoreClient)
+				};
+				if (eventManager.onGuildMemberRemoveEvent.functions.size() > 0) {
+					eventManager.onGuildMemberRemoveEvent(*dataPackage);
+				}
+				break;
+			}
+			case 28: {
+				std::unique_ptr<DiscordCoreAPI::OnGuildMemberUpdateData> dataPackage{
+					std::make_unique<DiscordCoreAPI::OnGuildMemberUpdateData>(message, dValue, this->discordCoreClient)
+				};
+				if (eventManager.onGuildMemberUpdateEvent.functions.size() > 0) {
+					eventManager.onGuildMemberUpdateEvent(*dataPackage);
+				}
+				break;
+			}
+			case 29: {
+				if (eventManager.onGuildMembersChunkEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnGuildMembersChunkData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnGuildMembersChunkData>(message, dValue)
+					};
+					eventManager.onGuildMembersChunkEvent(*dataPackage);
+				}
+				break;
+			}
+			case 30: {
+				std::unique_ptr<DiscordCoreAPI::OnRoleCreationData> dataPackage{
+					std::make_unique<DiscordCoreAPI::OnRoleCreationData>(message, dValue)
+				};
+				if (eventManager.onRoleCreationEvent.functions.size() > 0) {
+					eventManager.onRoleCreationEvent(*dataPackage);
+				}
+				break;
+			}
+			case 31: {
+				std::unique_ptr<DiscordCoreAPI::OnRoleUpdateData> dataPackage{
+					std::make_unique<DiscordCoreAPI::OnRoleUpdateData>(message, dValue)
+				};
+				if (eventManager.onRoleUpdateEvent.functions.size() > 0) {
+					eventManager.onRoleUpdateEvent(*dataPackage);
+				}
+				break;
+			}
+			case 32: {
+				std::unique_ptr<DiscordCoreAPI::OnRoleDeletionData> dataPackage{
+					std::make_unique<DiscordCoreAPI::OnRoleDeletionData>(message, dValue)
+				};
+				if (eventManager.onRoleDeletionEvent.functions.size() > 0) {
+					eventManager.onRoleDeletionEvent(*dataPackage);
+				}
+				break;
+			}
+			case 33: {
+				if (eventManager.onGuildScheduledEventCreationEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnGuildScheduledEventCreationData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnGuildScheduledEventCreationData>(message, dValue)
+					};
+					eventManager.onGuildScheduledEventCreationEvent(*dataPackage);
+				}
+				break;
+			}
+			case 34: {
+				if (eventManager.onGuildScheduledEventUpdateEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnGuildScheduledEventUpdateData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnGuildScheduledEventUpdateData>(message, dValue)
+					};
+					eventManager.onGuildScheduledEventUpdateEvent(*dataPackage);
+				}
+				break;
+			}
+			case 35: {
+				if (eventManager.onGuildScheduledEventDeletionEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnGuildScheduledEventDeletionData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnGuildScheduledEventDeletionData>(message, dValue)
+					};
+					eventManager.onGuildScheduledEventDeletionEvent(*dataPackage);
+				}
+				break;
+			}
+			case 36: {
+				if (eventManager.onGuildScheduledEventUserAddEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnGuildScheduledEventUserAddData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnGuildScheduledEventUserAddData>(message, dValue)
+					};
+					eventManager.onGuildScheduledEventUserAddEvent(*dataPackage);
+				}
+				break;
+			}
+			case 37: {
+				if (eventManager.onGuildScheduledEventUserRemoveEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnGuildScheduledEventUserRemoveData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnGuildScheduledEventUserRemoveData>(message, dValue)
+					};
+					eventManager.onGuildScheduledEventUserRemoveEvent(*dataPackage);
+				}
+				break;
+			}
+			case 52: {
+				if (eventManager.onPresenceUpdateEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnPresenceUpdateData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnPresenceUpdateData>(message, dValue)
+					};
+					eventManager.onPresenceUpdateEvent(*dataPackage);
+				}
+				break;
+			}
+			case 53: {
+				if (eventManager.onStageInstanceCreationEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnStageInstanceCreationData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnStageInstanceCreationData>(message, dValue)
+					};
+					eventManager.onStageInstanceCreationEvent(*dataPackage);
+				}
+				break;
+			}
+			case 54: {
+				if (eventManager.onStageInstanceUpdateEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnStageInstanceUpdateData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnStageInstanceUpdateData>(message, dValue)
+					};
+					eventManager.onStageInstanceUpdateEvent(*dataPackage);
+				}
+				break;
+			}
+			case 55: {
+				if (eventManager.onStageInstanceDeletionEvent.functions.size() > 0) {
+					std::unique_ptr<DiscordCoreAPI::OnStageInstanceDeletionData> dataPackage{
+						std::make_unique<DiscordCoreAPI::OnStageInstanceDeletionData>(message, dValue)
+					};
+					eventManager.onStageInstanceDeletionEvent(*dataPackage);
+				}
+				break;
+			}
+			case 58: {
+				std::unique_ptr<DiscordCoreAPI::OnVoiceStateUpdateData> dataPackage{
+					std::make_unique<DiscordCoreAPI::OnVoiceStateUpdateData>(message, dValue, nullptr)
+				};
+				if (eventManager.onVoiceStateUpdateEvent.functions.size() > 0) {
+					eventManager.onVoiceStateUpdateEvent(*dataPackage);
+				}
+				break;
+			}
+			default: {
+				break;
+			}
+		}
+	}
+
+	bool GuildIngestionPipeline::isItEnabled() const noexcept {
+		return !this->lanes.empty();
+	}
+
+	void GuildIngestionPipeline::markGuildIngested(uint32_t shard, uint64_t guildId) {
+		DiscordCoreAPI::OnGuildsReadyData dataPackage{};
+		{
+			std::unique_lock lock{ this->readyStateMutex };
+			auto state = this->readyStates.find(shard);
+			if (state == this->readyStates.end() || !state->second.pendingGuilds.erase(guildId) ||
+				!state->second.pendingGuilds.empty()) {
+				return;
+			}
+			dataPackage.guildCount = state->second.guildCount;
+			dataPackage.shardId = shard;
+			this->readyStates.erase(state);
+		}
+		DiscordCoreAPI::CacheSnapshots::finishReconciling(shard, this->discordCoreClient->configManager.getTotalShardCount());
+		this->discordCoreClient->eventManager.onGuildsReadyEvent(dataPackage);
+	}
+
+	void GuildIngestionPipeline::run(std::stop_token token, GuildIngestionLane& lane) noexcept {
+		while (!token.stop_requested()) {
+			GuildIngestionTask task{};
+			{
+				std::unique_lock lock{ lane.accessMutex };
+				if (!lane.taskCondVar.wait(lock, token, [&] {
+						return !lane.tasks.empty();
+					})) {
+					return;
+				}
+				task = std::move(lane.tasks.front());
+				lane.tasks.pop_front();
+			}
+			lane.spaceCondVar.notify_one();
+			try {
+				simdjson::ondemand::value dValue{};
+				if (lane.parser.iterate(simdjson::padded_string_view(task.payload.data(), task.payload.length(), task.payload.capacity()))
+						.get(dValue) == simdjson::error_code::SUCCESS) {
+					WebSocketMessage message{ dValue };
+					this->processGuildEvent(EventConverter{ message.t }, message, dValue, task.shard);
+				}
+			} catch (...) {
+				DiscordCoreAPI::reportException("GuildIngestionPipeline::run()");
+			}
+		}
+	}
+
+	GuildIngestionPipeline::~GuildIngestionPipeline() noexcept {
+		this->doWeQuit.store(true);
+		for (auto& value: this->lanes) {
+			{
+				std::unique_lock lock{ value->accessMutex };
+				value->tasks.clear();
+			}
+			value->spaceCondVar.notify_all();
+			value->thread.request_stop();
+			if (value->thread.joinable()) {
+				value->thread.join();
+			}
+		}
+	}
+
 	WebSocketClient::WebSocketClient(DiscordCoreAPI::DiscordCoreClient* client, int32_t currentShardNew, std::atomic_bool* doWeQuitNew)
 		: WebSocketCore(&client->configManager, WebSocketType::Normal) {
 		this->configManager = &client->configManager;
@@ -397,6 +829,23 @@ namespace DiscordCoreInternal {
 		}
 	}
 
+	void WebSocketClient::collectVoiceState(const DiscordCoreAPI::VoiceStateData& data) {
+		this->voiceConnectionData.sessionId = data.sessionId;
+		if (this->areWeCollectingData && !this->stateUpdateCollected && !this->serverUpdateCollected && data.userId == this->userId) {
+			this->voiceConnectionData = VoiceConnectionData{};
+			this->voiceConnectionData.sessionId = data.sessionId;
+			this->stateUpdateCollected = true;
+		} else if (this->areWeCollectingData && !this->stateUpdateCollected) {
+			this->voiceConnectionData.sessionId = data.sessionId;
+			if (this->voiceConnectionDataBuffersMap.contains(data.guildId.operator size_t())) {
+				this->voiceConnectionDataBuffersMap[data.guildId.operator size_t()]->send(this->voiceConnectionData);
+			}
+			this->serverUpdateCollected = false;
+			this->stateUpdateCollected = false;
+			this->areWeCollectingData = false;
+		}
+	}
+
 	void WebSocketClient::getVoiceConnectionData(const DiscordCoreAPI::VoiceConnectInitData& doWeCollect) noexcept {
 		while (this->currentState.load() != WebSocketState::Authenticated) {
 			std::this_thread::sleep_for(1ms);
@@ -506,6 +955,8 @@ namespace DiscordCoreInternal {
 												static_cast<int32_t>(this->discordCoreClient->configManager.getTotalShardCount())))]
 											.get() };
 									DiscordCoreAPI::Users::insertUser(std::move(data.user));
+									DiscordCoreAPI::CacheSnapshots::reconcileReady(this->shard[0], this->shard[1], data.guilds);
+									this->discordCoreClient->guildIngestionPipeline->expectGuilds(this->shard[0], data.guilds);
 									this->currentReconnectTries = 0;
 									break;
 								}
@@ -560,33 +1011,6 @@ namespace DiscordCoreInternal {
 									}
 									break;
 								}
-								case 8: {
-									std::unique_ptr<DiscordCoreAPI::OnChannelCreationData> dataPackage{
-										std::make_unique<DiscordCoreAPI::OnChannelCreationData>(message, dValue)
-									};
-									if (this->discordCoreClient->eventManager.onChannelCreationEvent.functions.size() > 0) {
-										this->discordCoreClient->eventManager.onChannelCreationEvent(*dataPackage);
-									}
-									break;
-								}
-								case 9: {
-									std::unique_ptr<DiscordCoreAPI::OnChannelUpdateData> dataPackage{
-										std::make_unique<DiscordCoreAPI::OnChannelUpdateData>(message, dValue)
-									};
-									if (this->discordCoreClient->eventManager.onChannelUpdateEvent.functions.size() > 0) {
-										this->discordCoreClient->eventManager.onChannelUpdateEvent(*dataPackage);
-									}
-									break;
-								}
-								case 10: {
-									std::unique_ptr<DiscordCoreAPI::OnChannelDeletionData> dataPackage{
-										std::make_unique<DiscordCoreAPI::OnChannelDeletionData>(message, dValue)
-									};
-									if (this->discordCoreClient->eventManager.onChannelDeletionEvent.functions.size() > 0) {
-										this->discordCoreClient->eventManager.onChannelDeletionEvent(*dataPackage);
-									}
-									break;
-								}
 								case 11: {
 									if (this->discordCoreClient->eventManager.onChannelPinsUpdateEvent.functions.size() > 0) {
 										std::unique_ptr<DiscordCoreAPI::OnChannelPinsUpdateData> dataPackage{
@@ -596,237 +1020,82 @@ namespace DiscordCoreInternal {
 									}
 									break;
 								}
-								case 12: {
-									if (this->discordCoreClient->eventManager.onThreadCreationEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnThreadCreationData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnThreadCreationData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onThreadCreationEvent(*dataPackage);
-									}
-									break;
-								}
-								case 13: {
-									if (this->discordCoreClient->eventManager.onThreadUpdateEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnThreadUpdateData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnThreadUpdateData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onThreadUpdateEvent(*dataPackage);
-									}
-									break;
-								}
-								case 14: {
-									if (this->discordCoreClient->eventManager.onThreadDeletionEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnThreadDeletionData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnThreadDeletionData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onThreadDeletionEvent(*dataPackage);
-									}
-									break;
-								}
-								case 15: {
-									if (this->discordCoreClient->eventManager.onThreadListSyncEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnThreadListSyncData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnThreadListSyncData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onThreadListSyncEvent(*dataPackage);
-									}
-									break;
-								}
-								case 16: {
-									if (this->discordCoreClient->eventManager.onThreadMemberUpdateEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnThreadMemberUpdateData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnThreadMemberUpdateData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onThreadMemberUpdateEvent(*dataPackage);
-									}
-									break;
-								}
-								case 17: {
-									if (this->discordCoreClient->eventManager.onThreadMembersUpdateEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnThreadMembersUpdateData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnThreadMembersUpdateData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onThreadMembersUpdateEvent(*dataPackage);
-									}
-									break;
-								}
-								case 18: {
-									std::unique_ptr<DiscordCoreAPI::OnGuildCreationData> dataPackage{
-										std::make_unique<DiscordCoreAPI::OnGuildCreationData>(message, dValue, this->discordCoreClient)
-									};
-									if (this->discordCoreClient->eventManager.onGuildCreationEvent.functions.size() > 0) {
-										this->discordCoreClient->eventManager.onGuildCreationEvent(*dataPackage);
-									}
-									break;
-								}
-								case 19: {
-									std::unique_ptr<DiscordCoreAPI::OnGuildUpdateData> dataPackage{
-										std::make_unique<DiscordCoreAPI::OnGuildUpdateData>(message, dValue, this->discordCoreClient)
-									};
-									if (this->discordCoreClient->eventManager.onGuildUpdateEvent.functions.size() > 0) {
-										this->discordCoreClient->eventManager.onGuildUpdateEvent(*dataPackage);
-									}
-									break;
-								}
+								case 8:
+									[[fallthrough]];
+								case 9:
+									[[fallthrough]];
+								case 10:
+									[[fallthrough]];
+								case 12:
+									[[fallthrough]];
+								case 13:
+									[[fallthrough]];
+								case 14:
+									[[fallthrough]];
+								case 15:
+									[[fallthrough]];
+								case 16:
+									[[fallthrough]];
+								case 17:
+									[[fallthrough]];
+								case 18:
+									[[fallthrough]];
+								case 19:
+									[[fallthrough]];
+								case 21:
+									[[fallthrough]];
+								case 22:
+									[[fallthrough]];
+								case 23:
+									[[fallthrough]];
+								case 24:
+									[[fallthrough]];
+								case 25:
+									[[fallthrough]];
+								case 26:
+									[[fallthrough]];
+								case 27:
+									[[fallthrough]];
+								case 28:
+									[[fallthrough]];
+								case 29:
+									[[fallthrough]];
+								case 30:
+									[[fallthrough]];
+								case 31:
+									[[fallthrough]];
+								case 32:
+									[[fallthrough]];
+								case 33:
+									[[fallthrough]];
+								case 34:
+									[[fallthrough]];
+								case 35:
+									[[fallthrough]];
+								case 36:
+									[[fallthrough]];
+								case 37:
+									[[fallthrough]];
+								case 52:
+									[[fallthrough]];
+								case 53:
+									[[fallthrough]];
+								case 54:
+									[[fallthrough]];
+								case 55:
+									[[fallthrough]];
 								case 20: {
-									std::unique_ptr<DiscordCoreAPI::OnGuildDeletionData> dataPackage{
-										std::make_unique<DiscordCoreAPI::OnGuildDeletionData>(message, dValue, this->discordCoreClient)
-									};
-									if (this->discordCoreClient->eventManager.onGuildDeletionEvent.functions.size() > 0) {
-										this->discordCoreClient->eventManager.onGuildDeletionEvent(*dataPackage);
-									}
-									break;
-								}
-								case 21: {
-									if (this->discordCoreClient->eventManager.onGuildBanAddEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnGuildBanAddData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnGuildBanAddData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onGuildBanAddEvent(*dataPackage);
-									}
-									break;
-								}
-								case 22: {
-									if (this->discordCoreClient->eventManager.onGuildBanRemoveEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnGuildBanRemoveData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnGuildBanRemoveData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onGuildBanRemoveEvent(*dataPackage);
-									}
-									break;
-								}
-								case 23: {
-									if (this->discordCoreClient->eventManager.onGuildEmojisUpdateEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnGuildEmojisUpdateData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnGuildEmojisUpdateData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onGuildEmojisUpdateEvent(*dataPackage);
-									}
-									break;
-								}
-								case 24: {
-									if (this->discordCoreClient->eventManager.onGuildStickersUpdateEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnGuildStickersUpdateData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnGuildStickersUpdateData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onGuildStickersUpdateEvent(*dataPackage);
-									}
-									break;
-								}
-								case 25: {
-									if (this->discordCoreClient->eventManager.onGuildIntegrationsUpdateEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnGuildIntegrationsUpdateData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnGuildIntegrationsUpdateData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onGuildIntegrationsUpdateEvent(*dataPackage);
-									}
-									break;
-								}
-								case 26: {
-									std::unique_ptr<DiscordCoreAPI::OnGuildMemberAddData> dataPackage{
-										std::make_unique<DiscordCoreAPI::OnGuildMemberAddData>(message, dValue, this->discordCoreClient)
-									};
-									if (this->discordCoreClient->eventManager.onGuildMemberAddEvent.functions.size() > 0) {
-										this->discordCoreClient->eventManager.onGuildMemberAddEvent(*dataPackage);
-									}
-									break;
-								}
-								case 27: {
-									std::unique_ptr<DiscordCoreAPI::OnGuildMemberRemoveData> dataPackage{
-										std::make_unique<DiscordCoreAPI::OnGuildMemberRemoveData>(message, dValue, this->discordCoreClient)
-									};
-									if (this->discordCoreClient->eventManager.onGuildMemberRemoveEvent.functions.size() > 0) {
-										this->discordCoreClient->eventManager.onGuildMemberRemoveEvent(*dataPackage);
-									}
-									break;
-								}
-								case 28: {
-									std::unique_ptr<DiscordCoreAPI::OnGuildMemberUpdateData> dataPackage{
-										std::make_unique<DiscordCoreAPI::OnGuildMemberUpdateData>(message, dValue, this->discordCoreClient)
-									};
-									if (this->discordCoreClient->eventManager.onGuildMemberUpdateEvent.functions.size() > 0) {
-										this->discordCoreClient->eventManager.onGuildMemberUpdateEvent(*dataPackage);
-									}
-									break;
-								}
-								case 29: {
-									if (this->discordCoreClient->eventManager.onGuildMembersChunkEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnGuildMembersChunkData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnGuildMembersChunkData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onGuildMembersChunkEvent(*dataPackage);
-									}
-									break;
-								}
-								case 30: {
-									std::unique_ptr<DiscordCoreAPI::OnRoleCreationData> dataPackage{
-										std::make_unique<DiscordCoreAPI::OnRoleCreationData>(message, dValue)
-									};
-									if (this->discordCoreClient->eventManager.onRoleCreationEvent.functions.size() > 0) {
-										this->discordCoreClient->eventManager.onRoleCreationEvent(*dataPackage);
-									}
-									break;
-								}
-								case 31: {
-									std::unique_ptr<DiscordCoreAPI::OnRoleUpdateData> dataPackage{
-										std::make_unique<DiscordCoreAPI::OnRoleUpdateData>(message, dValue)
-									};
-									if (this->discordCoreClient->eventManager.onRoleUpdateEvent.functions.size() > 0) {
-										this->discordCoreClient->eventManager.onRoleUpdateEvent(*dataPackage);
-									}
-									break;
-								}
-								case 32: {
-									std::unique_ptr<DiscordCoreAPI::OnRoleDeletionData> dataPackage{
-										std::make_unique<DiscordCoreAPI::OnRoleDeletionData>(message, dValue)
-									};
-									if (this->discordCoreClient->eventManager.onRoleDeletionEvent.functions.size() > 0) {
-										this->discordCoreClient->eventManager.onRoleDeletionEvent(*dataPackage);
-									}
-									break;
-								}
-								case 33: {
-									if (this->discordCoreClient->eventManager.onGuildScheduledEventCreationEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnGuildScheduledEventCreationData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnGuildScheduledEventCreationData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onGuildScheduledEventCreationEvent(*dataPackage);
-									}
-									break;
-								}
-								case 34: {
-									if (this->discordCoreClient->eventManager.onGuildScheduledEventUpdateEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnGuildScheduledEventUpdateData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnGuildScheduledEventUpdateData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onGuildScheduledEventUpdateEvent(*dataPackage);
-									}
-									break;
-								}
-								case 35: {
-									if (this->discordCoreClient->eventManager.onGuildScheduledEventDeletionEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnGuildScheduledEventDeletionData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnGuildScheduledEventDeletionData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onGuildScheduledEventDeletionEvent(*dataPackage);
-									}
-									break;
-								}
-								case 36: {
-									if (this->discordCoreClient->eventManager.onGuildScheduledEventUserAddEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnGuildScheduledEventUserAddData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnGuildScheduledEventUserAddData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onGuildScheduledEventUserAddEvent(*dataPackage);
-									}
-									break;
-								}
-								case 37: {
-									if (this->discordCoreClient->eventManager.onGuildScheduledEventUserRemoveEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnGuildScheduledEventUserRemoveData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnGuildScheduledEventUserRemoveData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onGuildScheduledEventUserRemoveEvent(*dataPackage);
+									auto& pipeline = *this->discordCoreClient->guildIngestionPipeline;
+									int32_t eventType{ EventConverter{ message.t } };
+									if (pipeline.isItEnabled()) {
+										simdjson::ondemand::value data{};
+										if (dValue["d"].get(data) == simdjson::error_code::SUCCESS) {
+											const char* key{ eventType >= 18 && eventType <= 20 ? "id" : "guild_id" };
+											uint64_t guildId{ static_cast<uint64_t>(DiscordCoreAPI::getId(data, key)) };
+											pipeline.submit(guildId, this->shard[0], std::move(payload));
+										}
+									} else {
+										pipeline.processGuildEvent(eventType, message, dValue, this->shard[0]);
 									}
 									break;
 								}
@@ -957,42 +1226,6 @@ namespace DiscordCoreInternal {
 									}
 									break;
 								}
-								case 52: {
-									if (this->discordCoreClient->eventManager.onPresenceUpdateEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnPresenceUpdateData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnPresenceUpdateData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onPresenceUpdateEvent(*dataPackage);
-									}
-									break;
-								}
-								case 53: {
-									if (this->discordCoreClient->eventManager.onStageInstanceCreationEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnStageInstanceCreationData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnStageInstanceCreationData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onStageInstanceCreationEvent(*dataPackage);
-									}
-									break;
-								}
-								case 54: {
-									if (this->discordCoreClient->eventManager.onStageInstanceUpdateEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnStageInstanceUpdateData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnStageInstanceUpdateData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onStageInstanceUpdateEvent(*dataPackage);
-									}
-									break;
-								}
-								case 55: {
-									if (this->discordCoreClient->eventManager.onStageInstanceDeletionEvent.functions.size() > 0) {
-										std::unique_ptr<DiscordCoreAPI::OnStageInstanceDeletionData> dataPackage{
-											std::make_unique<DiscordCoreAPI::OnStageInstanceDeletionData>(message, dValue)
-										};
-										this->discordCoreClient->eventManager.onStageInstanceDeletionEvent(*dataPackage);
-									}
-									break;
-								}
 								case 56: {
 									if (this->discordCoreClient->eventManager.onTypingStartEvent.functions.size() > 0) {
 										std::unique_ptr<DiscordCoreAPI::OnTypingStartData> dataPackage{
@@ -1012,6 +1245,24 @@ namespace DiscordCoreInternal {
 									break;
 								}
 								case 58: {
+									auto& pipeline = *this->discordCoreClient->guildIngestionPipeline;
+									if (pipeline.isItEnabled()) {
+										uint64_t guildId{};
+										if (this->areWeCollectingData) {
+											DiscordCoreAPI::VoiceStateData data{
+												message.processJsonMessage<DiscordCoreAPI::VoiceStateData>(dValue, "d")
+											};
+											this->collectVoiceState(data);
+											guildId = static_cast<uint64_t>(data.guildId);
+										} else {
+											simdjson::ondemand::value data{};
+											if (dValue["d"].get(data) == simdjson::error_code::SUCCESS) {
+												guildId = static_cast<uint64_t>(DiscordCoreAPI::getId(data, "guild_id"));
+											}
+										}
+										pipeline.submit(guildId, this->shard[0], std::move(payload));
+										break;
+									}
 									std::unique_ptr<DiscordCoreAPI::OnVoiceStateUpdateData> dataPackage{
 										std::make_unique<DiscordCoreAPI::OnVoiceStateUpdateData>(message, dValue, this)
 									};
@@ -240,6 +240,8 @@ namespace DiscordCoreInternal {
 
 	void YouTubeAPI::downloadAndStreamAudio(const DiscordCoreAPI::Song& newSong, std::stop_token token, int32_t currentReconnectTries) {
 		try {
+			AudioCache* audioCache = DiscordCoreAPI::DiscordCoreClient::getAudioCache(this->guildId);
+			std::unique_ptr<AudioCacheWriter> cacheWriter{ audioCache ? audioCache->beginWrite(newSong) : nullptr };
 			std::unique_ptr<WebSocketClient> streamSocket{ std::make_unique<WebSocketClient>(nullptr, 0, nullptr) };
 			auto bytesRead{ static_cast<int32_t>(streamSocket->getBytesRead()) };
 			if (newSong.finalDownloadUrls.size() > 0) {
@@ -397,13 +399,16 @@ namespace DiscordCoreInternal {
 								if (rawFrame.currentSize == -5) {
 									break;
 								}
-								if (rawFrame.currentSize > 3) {
+								if (rawFrame.currentSize > 3 || rawFrame.type == DiscordCoreAPI::AudioFrameType::Encoded) {
 									frames.emplace_back(std::move(rawFrame));
 								}
 							}
 						}
 						for (auto iterator = frames.begin(); iterator != frames.end();) {
 							iterator->guildMemberId = static_cast<DiscordCoreAPI::Song>(newSong).addedByUserId.operator size_t();
+							if (cacheWriter) {
+								cacheWriter->writeFrame(*iterator);
+							}
 							DiscordCoreAPI::DiscordCoreClient::getSongAPI(this->guildId)->audioDataBuffer.send(std::move(*iterator));
 							iterator = frames.erase(iterator);
 						}
@@ -420,6 +425,9 @@ namespace DiscordCoreInternal {
 			while (audioDecoder->getFrame(frameData01)) {
 			};
 			audioDecoder.reset(nullptr);
+			if (cacheWriter) {
+				cacheWriter->complete();
+			}
 			DiscordCoreAPI::AudioFrameData frameData{};
 			frameData.type = DiscordCoreAPI::AudioFrameType::Skip;
 			frameData.currentSize = 0;
@@ -0,0 +1,110 @@
+/*
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2021, 2022 Chris M. (RealTimeChris)
+
+	This library is free software; you can redistribute it and/or
+	modify it under the terms of the GNU Lesser General Public
+	License as published by the Free Software Foundation; either
+	version 2.1 of the License, or (at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+	Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public
+	License along with this library; if not, write to the Free Software
+	Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+	USA
+*/
+/// AudioMixerBenchmark.cpp - Per-frame costs of the AudioMixer's kernels, for 2, 8 and 32 speakers.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file AudioMixerBenchmark.cpp
+
+#include <discordcoreapi/Index.hpp>
+#include <discordcoreapi/AudioMixer.hpp>
+
+namespace DiscordCoreInternal {
+
+	/// \brief Times each of the AudioMixer's accumulate kernels that the CPU supports, and the whole mixer, on 20ms frames.
+	class AudioMixerBenchmark : public AudioMixer {
+	  public:
+		static constexpr uint64_t sampleCount{ 960 * 2 };///< One 20ms frame of 48kHz stereo.
+		static constexpr uint64_t iterationCount{ 20000 };
+
+		static void run() {
+			MixerInstructionSet instructionSet{ AudioMixer::getInstructionSet() };
+			std::cout << "Detected instruction set: " << static_cast<uint32_t>(instructionSet) << std::endl;
+			for (uint64_t speakerCount: { 2ull, 8ull, 32ull }) {
+				std::vector<std::vector<opus_int16>> speakers{ AudioMixerBenchmark::generateSpeakers(speakerCount) };
+				std::cout << speakerCount << " speakers:" << std::endl;
+				AudioMixerBenchmark::timeKernel("scalar", &AudioMixer::accumulateScalar, speakers);
+				if (instructionSet >= MixerInstructionSet::Sse41) {
+					AudioMixerBenchmark::timeKernel("sse4.1", &AudioMixer::accumulateSse41, speakers);
+				}
+				if (instructionSet >= MixerInstructionSet::Avx2) {
+					AudioMixerBenchmark::timeKernel("avx2", &AudioMixer::accumulateAvx2, speakers);
+				}
+				if (instructionSet >= MixerInstructionSet::Avx512) {
+					AudioMixerBenchmark::timeKernel("avx512", &AudioMixer::accumulateAvx512, speakers);
+				}
+				AudioMixerBenchmark::timeMixer(speakers);
+			}
+		}
+
+	  protected:
+		static std::vector<std::vector<opus_int16>> generateSpeakers(uint64_t speakerCount) {
+			std::mt19937 engine{ static_cast<uint32_t>(speakerCount) };
+			std::uniform_int_distribution<int32_t> distribution{ -32768, 32767 };
+			std::vector<std::vector<opus_int16>> speakers(speakerCount, std::vector<opus_int16>(sampleCount));
+			for (auto& speaker: speakers) {
+				for (auto& sample: speaker) {
+					sample = static_cast<opus_int16>(distribution(engine));
+				}
+			}
+			return speakers;
+		}
+
+		static void timeKernel(const std::string& label, AccumulateFunction function, const std::vector<std::vector<opus_int16>>& speakers) {
+			std::vector<float> accumulator(sampleCount);
+			auto startTime = SteadyClock::now();
+			for (uint64_t x = 0; x < iterationCount; ++x) {
+				std::fill(accumulator.begin(), accumulator.end(), 0.0f);
+				for (auto& speaker: speakers) {
+					function(accumulator.data(), speaker.data(), sampleCount, 0.7f);
+				}
+			}
+			AudioMixerBenchmark::report(label, SteadyClock::now() - startTime, accumulator[0]);
+		}
+
+		static void timeMixer(const std::vector<std::vector<opus_int16>>& speakers) {
+			AudioMixer mixer{};
+			int32_t peak{};
+			auto startTime = SteadyClock::now();
+			for (uint64_t x = 0; x < iterationCount; ++x) {
+				mixer.beginFrame();
+				for (auto& speaker: speakers) {
+					mixer.addSpeaker(std::basic_string_view<opus_int16>{ speaker.data(), speaker.size() }, 1.0f);
+				}
+				for (auto& value: mixer.endFrame()) {
+					peak = std::max(peak, std::abs(static_cast<int32_t>(value)));
+				}
+			}
+			AudioMixerBenchmark::report("mixer", SteadyClock::now() - startTime, static_cast<float>(peak));
+		}
+
+		static void report(const std::string& label, SteadyClock::duration elapsedTime, float checkValue) {
+			std::chrono::duration<double, std::micro> elapsedTimeInUs{ elapsedTime };
+			std::cout << "\t" << std::left << std::setw(8) << label << std::right << std::fixed << std::setprecision(2) << std::setw(8)
+					  << elapsedTimeInUs.count() / iterationCount << " us/frame (" << checkValue << ")" << std::endl;
+		}
+	};
+
+}
+
+int32_t main() {
+	DiscordCoreInternal::AudioMixerBenchmark::run();
+	return 0;
+}
@@ -0,0 +1,193 @@
+/*
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2021, 2022 Chris M. (RealTimeChris)
+
+	This library is free software; you can redistribute it and/or
+	modify it under the terms of the GNU Lesser General Public
+	License as published by the Free Software Foundation; either
+	version 2.1 of the License, or (at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+	Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public
+	License along with this library; if not, write to the Free Software
+	Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+	USA
+*/
+/// GuildMemberColumnsBenchmark.cpp - Heap footprint, insertion and lookup costs of caching GuildMembers one-per-entry versus as
+/// GuildMemberColumns tables.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file GuildMemberColumnsBenchmark.cpp
+
+#include <discordcoreapi/Index.hpp>
+#include <cstdlib>
+#include <new>
+
+namespace DiscordCoreAPI {
+
+	/// \brief Tracks the number of bytes currently held through the global operator new, which this benchmark replaces.
+	class HeapCounter {
+	  public:
+		static std::atomic_uint64_t liveBytes;
+
+		static void* allocate(std::size_t size) {
+			auto header = static_cast<std::size_t*>(std::malloc(size + HeapCounter::headerSize));
+			if (!header) {
+				throw std::bad_alloc{};
+			}
+			*header = size;
+			HeapCounter::liveBytes.fetch_add(size, std::memory_order_relaxed);
+			return reinterpret_cast<char*>(header) + HeapCounter::headerSize;
+		}
+
+		static void deallocate(void* ptr) noexcept {
+			if (!ptr) {
+				return;
+			}
+			auto header = reinterpret_cast<std::size_t*>(static_cast<char*>(ptr) - HeapCounter::headerSize);
+			HeapCounter::liveBytes.fetch_sub(*header, std::memory_order_relaxed);
+			std::free(header);
+		}
+
+	  protected:
+		static constexpr std::size_t headerSize{ 16 };
+	};
+
+	std::atomic_uint64_t HeapCounter::liveBytes{};
+
+	/// \brief Fills an ObjectCache<GuildMemberData> and the GuildMemberColumns tables that GuildMembers caches with the same members,
+	/// then compares their heap per member, insertion time, and time to look up and copy out a member.
+	class GuildMemberColumnsBenchmark {
+	  public:
+		static constexpr uint64_t membersPerGuild{ 10000 };
+		static constexpr uint64_t guildCount{ 100 };
+		static constexpr uint64_t roleCount{ 20 };
+
+		static void run() {
+			std::cout << guildCount << " Guilds of " << membersPerGuild << " GuildMembers:" << std::endl;
+			GuildMemberColumnsBenchmark::runPerMember();
+			GuildMemberColumnsBenchmark::runColumns();
+		}
+
+	  protected:
+		static constexpr uint64_t memberCount{ guildCount * membersPerGuild };
+
+		static void runPerMember() {
+			std::mt19937_64 randomEngine{ 1 };
+			uint64_t startBytes = HeapCounter::liveBytes.load();
+			auto cache = std::make_unique<ObjectCache<GuildMemberData>>();
+			auto startTime = SteadyClock::now();
+			for (uint64_t x = 0; x < memberCount; ++x) {
+				cache->emplace(GuildMemberColumnsBenchmark::makeGuildMember(randomEngine, x));
+			}
+			std::chrono::duration<double, std::nano> insertTime = SteadyClock::now() - startTime;
+			uint64_t heapBytes = HeapCounter::liveBytes.load() - startBytes;
+			uint64_t checksum{};
+			startTime = SteadyClock::now();
+			for (uint64_t x = 0; x < memberCount; ++x) {
+				uint64_t guildMemberId = GuildMemberColumnsBenchmark::getLookupId(x);
+				auto handle = cache->find(GuildScopedKey{ GuildMemberColumnsBenchmark::getGuildId(guildMemberId), guildMemberId });
+				GuildMemberData guildMember{ *handle };
+				checksum += guildMember.roles.size();
+			}
+			std::chrono::duration<double, std::nano> lookupTime = SteadyClock::now() - startTime;
+			GuildMemberColumnsBenchmark::print("ObjectCache<GuildMemberData>", heapBytes, insertTime, lookupTime, checksum);
+		}
+
+		static void runColumns() {
+			std::mt19937_64 randomEngine{ 1 };
+			uint64_t startBytes = HeapCounter::liveBytes.load();
+			auto cache = std::make_unique<ObjectCache<GuildMemberColumns>>();
+			auto startTime = SteadyClock::now();
+			for (uint64_t x = 0; x < memberCount; ++x) {
+				GuildMemberData guildMember = GuildMemberColumnsBenchmark::makeGuildMember(randomEngine, x);
+				cache->emplaceOrModify(GuildMemberColumns{ guildMember.guildId }, [&](GuildMemberColumns& guildMembers) {
+					guildMembers.insert(guildMember);
+				});
+			}
+			std::chrono::duration<double, std::nano> insertTime = SteadyClock::now() - startTime;
+			uint64_t heapBytes = HeapCounter::liveBytes.load() - startBytes;
+			uint64_t checksum{};
+			startTime = SteadyClock::now();
+			for (uint64_t x = 0; x < memberCount; ++x) {
+				uint64_t guildMemberId = GuildMemberColumnsBenchmark::getLookupId(x);
+				GuildMemberData guildMember{};
+				cache->visit(GuildMemberColumnsBenchmark::getGuildId(guildMemberId), [&](const GuildMemberColumns& guildMembers) {
+					guildMembers.getGuildMember(guildMemberId, guildMember);
+				});
+				checksum += guildMember.roles.size();
+			}
+			std::chrono::duration<double, std::nano> lookupTime = SteadyClock::now() - startTime;
+			GuildMemberColumnsBenchmark::print("ObjectCache<GuildMemberColumns>", heapBytes, insertTime, lookupTime, checksum);
+		}
+
+		/// Builds the index'th member: 0 to 3 of its Guild's Roles, and a 3 to 16 character nick for half of them.
+		static GuildMemberData makeGuildMember(std::mt19937_64& randomEngine, uint64_t index) {
+			GuildMemberData guildMember{};
+			guildMember.id = index + 1;
+			guildMember.guildId = GuildMemberColumnsBenchmark::getGuildId(index + 1);
+			guildMember.permissions = randomEngine();
+			guildMember.joinedAt = TimeStamp{ randomEngine() >> 24, TimeFormat::LongDateTime };
+			uint64_t roleCountNew = randomEngine() % 4;
+			for (uint64_t x = 0; x < roleCountNew; ++x) {
+				guildMember.roles.emplace_back(static_cast<uint64_t>(guildMember.guildId) * roleCount + randomEngine() % roleCount);
+			}
+			if (randomEngine() % 2 == 0) {
+				guildMember.nick = std::string(3 + randomEngine() % 14, static_cast<char>('a' + randomEngine() % 26));
+			}
+			return guildMember;
+		}
+
+		static uint64_t getGuildId(uint64_t guildMemberId) noexcept {
+			return (guildMemberId - 1) / membersPerGuild + 1;
+		}
+
+		/// Strides through the members, so that consecutive lookups land in different Guilds.
+		static uint64_t getLookupId(uint64_t index) noexcept {
+			return (index * 7919) % memberCount + 1;
+		}
+
+		static void print(const std::string& label, uint64_t heapBytes, std::chrono::duration<double, std::nano> insertTime,
+			std::chrono::duration<double, std::nano> lookupTime, uint64_t checksum) {
+			std::cout << "\t" << std::left << std::setw(32) << label << std::right << std::fixed << std::setprecision(1) << std::setw(8)
+					  << static_cast<double>(heapBytes) / memberCount << " bytes/member, " << std::setw(8)
+					  << insertTime.count() / memberCount << " ns/insert, " << std::setw(8) << lookupTime.count() / memberCount
+					  << " ns/lookup (" << checksum << ")" << std::endl;
+		}
+	};
+
+}
+
+void* operator new(std::size_t size) {
+	return DiscordCoreAPI::HeapCounter::allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+	return DiscordCoreAPI::HeapCounter::allocate(size);
+}
+
+void operator delete(void* ptr) noexcept {
+	DiscordCoreAPI::HeapCounter::deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+	DiscordCoreAPI::HeapCounter::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+	DiscordCoreAPI::HeapCounter::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+	DiscordCoreAPI::HeapCounter::deallocate(ptr);
+}
+
+int32_t main() {
+	DiscordCoreAPI::GuildMemberColumnsBenchmark::run();
+	return 0;
+}
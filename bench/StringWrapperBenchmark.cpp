@@ -0,0 +1,95 @@
+/*
+	DiscordCoreAPI, A bot library for Discord, written in C++, and featuring explicit multithreading through the usage of custom, asynchronous C++ CoRoutines.
+
+	Copyright 2021, 2022 Chris M. (RealTimeChris)
+
+	This library is free software; you can redistribute it and/or
+	modify it under the terms of the GNU Lesser General Public
+	License as published by the Free Software Foundation; either
+	version 2.1 of the License, or (at your option) any later version.
+
+	This library is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+	Lesser General Public License for more details.
+
+	You should have received a copy of the GNU Lesser General Public
+	License along with this library; if not, write to the Free Software
+	Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+	USA
+*/
+/// StringWrapperBenchmark.cpp - Per-call costs of the StringWrapper equality and concatenation operators.
+/// Oct 19, 2026
+/// https://discordcoreapi.com
+/// \file StringWrapperBenchmark.cpp
+
+#include <discordcoreapi/Index.hpp>
+
+namespace DiscordCoreAPI {
+
+	/// \brief Times the StringWrapper operators from Utilities.hpp, next to the same operations on std::string.
+	class StringWrapperBenchmark {
+	  public:
+		static constexpr uint64_t iterationCount{ 5000000 };
+
+		static void run() {
+			const std::string shortString{ "RealTimeChris" };
+			const std::string longString{ "A Guild name that is far too long to be stored inline" };
+			StringInterner::setEnabled(true);
+			StringWrapperBenchmark::runCases("short", shortString, StringWrapper{ shortString }, StringWrapper{ shortString });
+			StringWrapperBenchmark::runCases("long", longString, StringWrapper{ longString }, StringWrapper{ longString });
+			StringWrapperBenchmark::runCases("interned", longString, StringWrapper::intern(longString), StringWrapper::intern(longString));
+		}
+
+	  protected:
+		static void runCases(const std::string& label, const std::string& string, const StringWrapper& lhs, const StringWrapper& rhs) {
+			const std::string stringCopy{ string };
+			const std::string prefix{ "Name: " };
+			std::cout << label << " (" << string.size() << " characters):" << std::endl;
+			StringWrapperBenchmark::time("std::string == std::string", [&] {
+				return string == stringCopy;
+			});
+			StringWrapperBenchmark::time("StringWrapper == StringWrapper", [&] {
+				return lhs == rhs;
+			});
+			StringWrapperBenchmark::time("StringWrapper == const char*", [&] {
+				return lhs == stringCopy.c_str();
+			});
+			StringWrapperBenchmark::time("StringWrapper != const char*", [&] {
+				return lhs != stringCopy.c_str();
+			});
+			StringWrapperBenchmark::time("std::string == StringWrapper", [&] {
+				return stringCopy == rhs;
+			});
+			StringWrapperBenchmark::time("std::string + std::string", [&] {
+				return (prefix + string).size();
+			});
+			StringWrapperBenchmark::time("std::string + StringWrapper", [&] {
+				return (prefix + lhs).size();
+			});
+			StringWrapperBenchmark::time("const char* + StringWrapper", [&] {
+				return ("Name: " + lhs).size();
+			});
+			StringWrapperBenchmark::time("StringWrapper + const char*", [&] {
+				return (lhs + "'s roles").size();
+			});
+		}
+
+		template<typename FTy> static void time(const std::string& label, FTy&& function) {
+			uint64_t checksum{};
+			auto startTime = SteadyClock::now();
+			for (uint64_t x = 0; x < iterationCount; ++x) {
+				checksum += static_cast<uint64_t>(function());
+			}
+			std::chrono::duration<double, std::nano> elapsedTime = SteadyClock::now() - startTime;
+			std::cout << "\t" << std::left << std::setw(32) << label << std::right << std::fixed << std::setprecision(2) << std::setw(8)
+					  << elapsedTime.count() / iterationCount << " ns/call (" << checksum << ")" << std::endl;
+		}
+	};
+
+}
+
+int32_t main() {
+	DiscordCoreAPI::StringWrapperBenchmark::run();
+	return 0;
+}